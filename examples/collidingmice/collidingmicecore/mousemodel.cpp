@@ -70,14 +70,7 @@ void MouseModel::writeToFile(const QString& name)
 void MouseModel::setUndoPosition(int value)
 {
     int desired_command_id = undoStack()->count() * std::clamp(value, 0, 100) / 100;
-
-    if (undoStack()->index() < desired_command_id) {
-        while (undoStack()->index() != desired_command_id)
-            undoStack()->redo(); // going forward
-    } else {
-        while (undoStack()->index() != desired_command_id)
-            undoStack()->undo(); // going back in time
-    }
+    setUndoIndex(desired_command_id);
 }
 
 void MouseModel::populate_model()
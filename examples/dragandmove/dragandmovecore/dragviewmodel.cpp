@@ -13,6 +13,7 @@
 #include <QDataStream>
 #include <QDebug>
 #include <QMimeData>
+#include <mvvm/core/uniqueid.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/viewmodel/viewmodelutils.h>
@@ -66,7 +67,7 @@ QMimeData* DragViewModel::mimeData(const QModelIndexList& index_list) const
 
     QStringList identifiers;
     for (auto item : Utils::ParentItemsFromIndex(index_list))
-        identifiers.append(QString::fromStdString(item->identifier()));
+        identifiers.append(QString::fromStdString(Utils::IdentifierToString(item->identifier())));
 
     mimeData->setData(QString::fromStdString(::Constants::AppMimeType), serialize(identifiers));
     return mimeData;
@@ -105,7 +106,7 @@ bool DragViewModel::dropMimeData(const QMimeData* data, Qt::DropAction action, i
     // retrieving list of item identifiers and accessing items
     auto identifiers = deserialize(data->data(QString::fromStdString(::Constants::AppMimeType)));
     for (auto id : identifiers) {
-        auto item = sessionModel()->findItem(id.toStdString());
+        auto item = sessionModel()->findItem(Utils::IdentifierFromString(id.toStdString()));
 
         qDebug() << "going to move" << id << item << requested_row;
         int row = std::clamp(requested_row, 0, item->parent()->itemCount(item->tag()) - 1);
@@ -10,6 +10,7 @@
 #include <QColor>
 #include <layereditorcore/model/materialitems.h>
 #include <layereditorcore/model/materialmodel.h>
+#include <mvvm/core/uniqueid.h>
 #include <mvvm/model/externalproperty.h>
 #include <mvvm/model/itemcatalogue.h>
 
@@ -52,7 +53,7 @@ std::vector<ExternalProperty> MaterialModel::material_data()
             if (auto material = dynamic_cast<SLDMaterialItem*>(item)) {
                 auto text = material->property<std::string>(SLDMaterialItem::P_NAME);
                 auto color = material->property<QColor>(SLDMaterialItem::P_COLOR);
-                auto id = material->identifier();
+                auto id = Utils::IdentifierToString(material->identifier());
                 result.push_back(ExternalProperty(text, color, id));
             }
         }
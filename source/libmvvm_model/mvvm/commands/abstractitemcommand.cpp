@@ -18,7 +18,9 @@ using namespace ModelView;
 struct AbstractItemCommand::AbstractItemCommandImpl {
     enum EStatus { INITIAL, AFTER_EXECUTE, AFTER_UNDO };
     bool is_obsolete{false};
+    int merge_id{-1};
     std::string text;
+    bool has_text{false}; //! description was either set or generated
     EStatus status{INITIAL};
     SessionModel* model{nullptr};
     AbstractItemCommand* parent_impl{nullptr};
@@ -75,13 +77,47 @@ bool AbstractItemCommand::isObsolete() const
     return p_impl->is_obsolete;
 }
 
-//! Returns command description.
+//! Returns command description. If it wasn't set explicitly, it is generated on first request.
 
 std::string AbstractItemCommand::description() const
 {
+    if (!p_impl->has_text) {
+        p_impl->text = describe_command();
+        p_impl->has_text = true;
+    }
     return p_impl->text;
 }
 
+//! Returns id of the command used to find commands which can be merged together.
+//! Value -1 means that the command can't be merged.
+
+int AbstractItemCommand::mergeId() const
+{
+    return p_impl->merge_id;
+}
+
+//! Attempts to merge other command, executed right after this one, into this command.
+//! Returns true on success, other command can be dropped then.
+
+bool AbstractItemCommand::mergeWith(const AbstractItemCommand* other)
+{
+    if (!other || mergeId() == -1 || other->mergeId() != mergeId())
+        return false;
+
+    if (isObsolete() || other->isObsolete())
+        return false;
+
+    return merge_command(other);
+}
+
+//! Returns approximate number of bytes occupied by the command, including values and items
+//! it keeps to be able to undo/redo.
+
+std::size_t AbstractItemCommand::byteSize() const
+{
+    return sizeof(AbstractItemCommandImpl) + p_impl->text.capacity() + payload_size();
+}
+
 //! Sets command obsolete flag.
 
 void AbstractItemCommand::setObsolete(bool flag)
@@ -94,6 +130,45 @@ void AbstractItemCommand::setObsolete(bool flag)
 void AbstractItemCommand::setDescription(const std::string& text)
 {
     p_impl->text = text;
+    p_impl->has_text = true;
+}
+
+//! Discards current description, so it will be generated again on next request.
+
+void AbstractItemCommand::resetDescription()
+{
+    p_impl->text.clear();
+    p_impl->has_text = false;
+}
+
+//! Sets id of the command. Commands with the same id (other than -1) are candidates for merging.
+
+void AbstractItemCommand::setMergeId(int id)
+{
+    p_impl->merge_id = id;
+}
+
+//! Merges other command into this one. Default implementation doesn't allow merging.
+
+bool AbstractItemCommand::merge_command(const AbstractItemCommand*)
+{
+    return false;
+}
+
+//! Returns approximate number of bytes of data kept by the command. Default implementation
+//! assumes that the command doesn't keep anything noticeable.
+
+std::size_t AbstractItemCommand::payload_size() const
+{
+    return 0;
+}
+
+//! Generates command description. It is called on first request of the description only, since
+//! many commands (executed without undo stack or merged together) never need it.
+
+std::string AbstractItemCommand::describe_command() const
+{
+    return {};
 }
 
 Path AbstractItemCommand::pathFromItem(SessionItem* item) const
@@ -37,9 +37,17 @@ public:
 
     std::string description() const;
 
+    int mergeId() const;
+
+    bool mergeWith(const AbstractItemCommand* other);
+
+    std::size_t byteSize() const;
+
 protected:
     void setObsolete(bool flag);
     void setDescription(const std::string& text);
+    void resetDescription();
+    void setMergeId(int id);
     Path pathFromItem(SessionItem* item) const;
     SessionItem* itemFromPath(const Path& path) const;
     SessionModel* model() const;
@@ -47,6 +55,9 @@ protected:
 private:
     virtual void execute_command() = 0;
     virtual void undo_command() = 0;
+    virtual bool merge_command(const AbstractItemCommand* other);
+    virtual std::size_t payload_size() const;
+    virtual std::string describe_command() const;
 
     struct AbstractItemCommandImpl;
     std::unique_ptr<AbstractItemCommandImpl> p_impl;
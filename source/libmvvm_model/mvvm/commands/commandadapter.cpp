@@ -9,24 +9,105 @@
 
 #include <mvvm/commands/abstractitemcommand.h>
 #include <mvvm/commands/commandadapter.h>
+#include <stdexcept>
 
 using namespace ModelView;
 
-CommandAdapter::CommandAdapter(std::shared_ptr<AbstractItemCommand> command)
-    : m_command(std::move(command))
+//! Constructs adapter for given command. If 'memory_usage' counter is provided, the adapter
+//! keeps it up to date with the size of the command. If 'locked' flag is provided, undo/redo
+//! throw while it is set. QUndoStack updates its index only after the command succeeded, so the
+//! stack stays where it was. Both counter and flag have to outlive the adapter.
+
+CommandAdapter::CommandAdapter(std::shared_ptr<AbstractItemCommand> command,
+                               std::size_t* memory_usage, const bool* locked)
+    : m_command(std::move(command)), m_memory_usage(memory_usage), m_locked(locked)
 {
+    update_memory_usage();
 }
 
-CommandAdapter::~CommandAdapter() = default;
+CommandAdapter::~CommandAdapter()
+{
+    if (m_memory_usage)
+        *m_memory_usage -= m_byte_size;
+}
 
 void CommandAdapter::undo()
 {
+    if (m_locked && *m_locked)
+        throw std::runtime_error("CommandAdapter::undo() -> Error. Undo stack is locked.");
+
+    if (!m_command)
+        return;
+
     m_command->undo();
+    update_memory_usage();
 }
 
 void CommandAdapter::redo()
 {
+    if (m_locked && *m_locked)
+        throw std::runtime_error("CommandAdapter::redo() -> Error. Undo stack is locked.");
+
+    if (!m_command)
+        return;
+
     m_command->execute();
     setObsolete(m_command->isObsolete());
-    setText(QString::fromStdString(m_command->description()));
+    // QUndoCommand::text() isn't virtual, the text has to be set before the stack asks for it
+    if (text().isEmpty())
+        setText(QString::fromStdString(m_command->description()));
+    update_memory_usage();
+}
+
+//! Returns id of the underlying command, Qt stack tries to merge commands with the same id.
+
+int CommandAdapter::id() const
+{
+    return m_command ? m_command->mergeId() : -1;
+}
+
+//! Merges given command, pushed right after this one, into this command. The stack redoes the
+//! command before merging, so its text already describes the merged result.
+
+bool CommandAdapter::mergeWith(const QUndoCommand* command)
+{
+    auto adapter = dynamic_cast<const CommandAdapter*>(command);
+    if (!adapter || !m_command || !m_command->mergeWith(adapter->m_command.get()))
+        return false;
+
+    setText(adapter->text());
+    update_memory_usage();
+    return true;
+}
+
+//! Returns approximate number of bytes occupied by the underlying command.
+
+std::size_t CommandAdapter::byteSize() const
+{
+    return m_byte_size;
+}
+
+//! Releases underlying command together with all the data it keeps. The adapter becomes obsolete
+//! and doesn't do anything on undo/redo. Qt stack drops obsolete commands when it reaches them.
+
+void CommandAdapter::evict()
+{
+    m_command.reset();
+    setObsolete(true);
+    update_memory_usage();
+}
+
+//! Returns true if underlying command was released.
+
+bool CommandAdapter::isEvicted() const
+{
+    return m_command == nullptr;
+}
+
+void CommandAdapter::update_memory_usage()
+{
+    auto byte_size = m_command ? m_command->byteSize() : 0;
+    if (m_memory_usage)
+        *m_memory_usage = *m_memory_usage - m_byte_size + byte_size;
+    m_byte_size = byte_size;
 }
@@ -24,14 +24,29 @@ class AbstractItemCommand;
 class MVVM_MODEL_EXPORT CommandAdapter : public QUndoCommand
 {
 public:
-    CommandAdapter(std::shared_ptr<AbstractItemCommand> command);
+    CommandAdapter(std::shared_ptr<AbstractItemCommand> command,
+                   std::size_t* memory_usage = nullptr, const bool* locked = nullptr);
     ~CommandAdapter() override;
 
     void undo() override;
     void redo() override;
 
+    int id() const override;
+    bool mergeWith(const QUndoCommand* command) override;
+
+    std::size_t byteSize() const;
+
+    void evict();
+
+    bool isEvicted() const;
+
 private:
+    void update_memory_usage();
+
     std::shared_ptr<AbstractItemCommand> m_command;
+    std::size_t m_byte_size{0};           //! size of the command at last update
+    std::size_t* m_memory_usage{nullptr}; //! external counter of the total memory usage
+    const bool* m_locked{nullptr};        //! external flag, undo/redo are rejected while it is set
 };
 
 } // namespace ModelView
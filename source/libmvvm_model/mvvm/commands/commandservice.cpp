@@ -15,12 +15,15 @@
 #include <mvvm/commands/setvaluecommand.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
+#include <mvvm/signals/modelmapper.h>
 #include <stdexcept>
 
 using namespace ModelView;
 
 CommandService::CommandService(SessionModel* model) : m_model(model), m_pause_record(false) {}
 
+CommandService::~CommandService() = default;
+
 void CommandService::setUndoRedoEnabled(bool value)
 {
     if (value)
@@ -60,7 +63,8 @@ bool CommandService::setData(SessionItem* item, const QVariant& value, int role)
     if (!item)
         return false;
 
-    return process_command<SetValueCommand>(item, value, role);
+    SetValueMergePolicy policy{std::chrono::milliseconds(m_merge_window), m_edit_session};
+    return process_command<SetValueCommand>(item, value, role, policy);
 }
 
 void CommandService::removeItem(SessionItem* parent, const TagRow& tagrow)
@@ -97,7 +101,172 @@ void CommandService::setCommandRecordPause(bool value)
     m_pause_record = value;
 }
 
+//! Sets time window in milliseconds. Consecutive changes of the same item's data, coming faster
+//! than given interval, will be merged into single undo command. Value 0 disables merging.
+
+void CommandService::setMergeWindow(int msec)
+{
+    m_merge_window = msec;
+}
+
+//! Starts edit session (i.e. dragging of the item on canvas or spinning of the spin box).
+//! Until the end of the session, all consecutive changes of the same item's data will be
+//! merged into single undo command, regardless of merge window.
+
+void CommandService::beginEditSession()
+{
+    m_edit_session = ++m_session_count;
+}
+
+//! Finishes edit session.
+
+void CommandService::endEditSession()
+{
+    m_edit_session = 0;
+}
+
+/*!
+@brief Starts transaction.
+
+All following commands are executed immediately and recorded. On commit, they are pushed into
+the undo stack as a single command with given description. On rollback, they are undone in
+reverse order. Data change notifications are batched until the end of the transaction.
+Insert and remove notifications are not batched: view models have to follow the layout of the
+model step by step, so listeners see intermediate structural changes even if the transaction is
+rolled back afterwards. Rollback then emits notifications for the reverse changes.
+Commands already in the undo stack can't be undone or redone until the end of the transaction,
+QUndoStack::undo(), redo() and setIndex() throw and leave the stack unchanged.
+*/
+
+void CommandService::beginTransaction(const std::string& description)
+{
+    if (m_transaction)
+        throw std::runtime_error(
+            "CommandService::beginTransaction() -> Error. Transaction is already active.");
+
+    m_transaction = std::make_unique<MacroCommand>(m_model->rootItem(), description);
+    m_stack_locked = true;
+    m_model->mapper()->beginBatch();
+}
+
+//! Commits transaction. Recorded commands are pushed into the undo stack as a single command.
+
+void CommandService::commitTransaction()
+{
+    if (!m_transaction)
+        throw std::runtime_error(
+            "CommandService::commitTransaction() -> Error. No active transaction.");
+
+    auto transaction = std::move(m_transaction);
+    m_stack_locked = false;
+    try {
+        if (provideUndo() && transaction->commandCount() > 0) {
+            m_commands->push(
+                new CommandAdapter(std::move(transaction), &m_memory_usage, &m_stack_locked));
+            evict_commands();
+        }
+    } catch (...) {
+        m_model->mapper()->endBatch();
+        throw;
+    }
+
+    m_model->mapper()->endBatch();
+}
+
+//! Rolls back transaction. All recorded commands are undone in reverse order.
+
+void CommandService::rollbackTransaction()
+{
+    if (!m_transaction)
+        throw std::runtime_error(
+            "CommandService::rollbackTransaction() -> Error. No active transaction.");
+
+    auto transaction = std::move(m_transaction);
+    m_stack_locked = false;
+    try {
+        transaction->rollback();
+    } catch (...) {
+        m_model->mapper()->endBatch();
+        throw;
+    }
+
+    m_model->mapper()->endBatch();
+}
+
+//! Returns true if transaction is in progress.
+
+bool CommandService::isTransactionActive() const
+{
+    return m_transaction != nullptr;
+}
+
+/*!
+@brief Sets approximate memory budget in bytes for the undo stack.
+
+When the size of all commands in the stack exceeds the budget, oldest commands are evicted: the
+data they keep is released and they can't be undone anymore. The last executed command is never
+evicted, even if it alone exceeds the budget. Value 0 (default) means that there is no limit.
+
+QUndoStack can't remove commands from the bottom of the stack. Evicted commands stay there as
+empty obsolete entries: they are still counted by QUndoStack::count() and canUndo(), and each of
+them takes one undo step which doesn't change the model and deletes the entry.
+*/
+
+void CommandService::setUndoMemoryLimit(std::size_t bytes)
+{
+    m_memory_limit = bytes;
+    evict_commands();
+}
+
+//! Returns approximate number of bytes occupied by commands in the undo stack.
+
+std::size_t CommandService::undoMemoryUsage() const
+{
+    return m_memory_usage;
+}
+
+/*!
+@brief Brings the model to the state corresponding to given position in the undo stack.
+
+All commands between current and target positions are replayed with data change notifications
+batched, so each changed item reports the change only once, when the target is reached.
+Structural notifications (insert/remove) are emitted immediately to keep views consistent.
+*/
+
+void CommandService::setUndoIndex(int index)
+{
+    if (!m_commands)
+        return;
+
+    if (m_transaction)
+        throw std::runtime_error(
+            "CommandService::setUndoIndex() -> Error. Transaction is active.");
+
+    if (index == m_commands->index())
+        return;
+
+    ModelMapper::BatchGuard guard(m_model->mapper());
+    m_commands->setIndex(index);
+}
+
 bool CommandService::provideUndo() const
 {
     return m_commands && !m_pause_record;
 }
+
+//! Evicts oldest commands until the memory usage fits into the budget. Commands are evicted
+//! strictly from the bottom of the stack, so the undo/redo chain above them stays intact.
+//! QUndoStack gives only const access to its commands. Casting constness away is safe, since all
+//! adapters were created by this service as non-const objects.
+
+void CommandService::evict_commands()
+{
+    if (!m_commands || m_memory_limit == 0)
+        return;
+
+    for (int i = 0; i < m_commands->index() - 1 && m_memory_usage > m_memory_limit; ++i) {
+        auto adapter = dynamic_cast<const CommandAdapter*>(m_commands->command(i));
+        if (adapter && !adapter->isEvicted())
+            const_cast<CommandAdapter*>(adapter)->evict();
+    }
+}
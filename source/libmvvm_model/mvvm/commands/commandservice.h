@@ -13,8 +13,10 @@
 #include <QUndoStack>
 #include <memory>
 #include <mvvm/commands/commandadapter.h>
+#include <mvvm/commands/macrocommand.h>
 #include <mvvm/model/function_types.h>
 #include <mvvm/model_export.h>
+#include <string>
 
 class QUndoCommand;
 class QVariant;
@@ -32,6 +34,7 @@ class MVVM_MODEL_EXPORT CommandService
 {
 public:
     CommandService(SessionModel* model);
+    ~CommandService();
 
     void setUndoRedoEnabled(bool value);
 
@@ -50,14 +53,42 @@ public:
 
     void setCommandRecordPause(bool value);
 
+    void setMergeWindow(int msec);
+
+    void beginEditSession();
+
+    void endEditSession();
+
+    void beginTransaction(const std::string& description);
+
+    void commitTransaction();
+
+    void rollbackTransaction();
+
+    bool isTransactionActive() const;
+
+    void setUndoMemoryLimit(std::size_t bytes);
+
+    std::size_t undoMemoryUsage() const;
+
+    void setUndoIndex(int index);
+
 private:
     template <typename C, typename... Args> typename C::result_t process_command(Args&&... args);
 
     bool provideUndo() const;
+    void evict_commands();
 
     SessionModel* m_model;
+    std::size_t m_memory_usage{0}; //! approximate size of commands in the stack, has to outlive it
+    std::size_t m_memory_limit{0}; //! memory budget for the stack in bytes, 0 if there is no limit
+    bool m_stack_locked{false};    //! stack commands can't be undone/redone, has to outlive it
     std::unique_ptr<QUndoStack> m_commands;
     bool m_pause_record;
+    int m_merge_window{0};  //! max interval in msec between set value commands to merge them
+    int m_edit_session{0};  //! id of current edit session, 0 if there is no session
+    int m_session_count{0}; //! number of edit sessions started so far
+    std::unique_ptr<MacroCommand> m_transaction; //! commands recorded in current transaction
 };
 
 //! Creates and processes command of given type using given argument list.
@@ -67,11 +98,17 @@ typename C::result_t CommandService::process_command(Args&&... args)
 {
     typename C::result_t result;
 
-    if (provideUndo()) {
+    if (m_transaction) {
+        auto command = std::make_shared<C>(std::forward<Args>(args)...);
+        command->execute();
+        result = command->result();
+        m_transaction->addCommand(std::move(command));
+    } else if (provideUndo()) {
         auto command = std::make_shared<C>(std::forward<Args>(args)...);
-        auto adapter = new CommandAdapter(command);
+        auto adapter = new CommandAdapter(command, &m_memory_usage, &m_stack_locked);
         m_commands->push(adapter);
         result = command->result();
+        evict_commands();
     } else {
         auto command = std::make_unique<C>(std::forward<Args>(args)...);
         command->execute();
@@ -8,6 +8,7 @@
 // ************************************************************************** //
 
 #include <mvvm/commands/copyitemcommand.h>
+#include <mvvm/model/itemutils.h>
 #include <mvvm/model/path.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
@@ -27,20 +28,23 @@ struct CopyItemCommand::CopyItemCommandImpl {
     result_t result;
     std::unique_ptr<ItemBackupStrategy> backup_strategy;
     Path item_path;
+    std::size_t backup_size{0}; //! approximate size of the item kept in backup
+    std::string model_type;     //! type of copied item, used in description
     CopyItemCommandImpl(TagRow tagrow) : tagrow(std::move(tagrow)), result(nullptr) {}
 };
 
 CopyItemCommand::CopyItemCommand(const SessionItem* item, SessionItem* parent, TagRow tagrow)
     : AbstractItemCommand(parent), p_impl(std::make_unique<CopyItemCommandImpl>(std::move(tagrow)))
 {
-    setDescription(generate_description(item->modelType(), p_impl->tagrow));
+    p_impl->model_type = item->modelType();
     p_impl->backup_strategy = parent->model()->itemBackupStrategy();
     p_impl->item_path = pathFromItem(parent);
 
     auto copy_strategy = parent->model()->itemCopyStrategy(); // to modify id's
     auto item_copy = copy_strategy->createCopy(item);
 
-    p_impl->backup_strategy->saveItem(item_copy.get());
+    p_impl->backup_size = Utils::ItemByteSize(*item_copy);
+    p_impl->backup_strategy->keepItem(std::move(item_copy));
 }
 
 CopyItemCommand::~CopyItemCommand() = default;
@@ -48,7 +52,9 @@ CopyItemCommand::~CopyItemCommand() = default;
 void CopyItemCommand::undo_command()
 {
     auto parent = itemFromPath(p_impl->item_path);
-    delete parent->takeItem(p_impl->tagrow);
+    auto item = std::unique_ptr<SessionItem>(parent->takeItem(p_impl->tagrow));
+    p_impl->backup_size = item ? Utils::ItemByteSize(*item) : 0;
+    p_impl->backup_strategy->keepItem(std::move(item));
     p_impl->result = nullptr;
 }
 
@@ -56,6 +62,7 @@ void CopyItemCommand::execute_command()
 {
     auto parent = itemFromPath(p_impl->item_path);
     auto item = p_impl->backup_strategy->restoreItem();
+    p_impl->backup_size = 0;
     if (parent->insertItem(item.get(), p_impl->tagrow)) {
         p_impl->result = item.release();
     } else {
@@ -64,6 +71,16 @@ void CopyItemCommand::execute_command()
     }
 }
 
+std::size_t CopyItemCommand::payload_size() const
+{
+    return sizeof(CopyItemCommandImpl) + p_impl->backup_size;
+}
+
+std::string CopyItemCommand::describe_command() const
+{
+    return generate_description(p_impl->model_type, p_impl->tagrow);
+}
+
 CopyItemCommand::result_t CopyItemCommand::result() const
 {
     return p_impl->result;
@@ -24,6 +24,7 @@ struct InsertNewItemCommand::InsertNewItemCommandImpl {
     TagRow tagrow;
     result_t result;
     Path item_path;
+    std::string model_type; //! type of inserted item, used in description
     InsertNewItemCommandImpl(item_factory_func_t func, TagRow tagrow)
         : factory_func(std::move(func)), tagrow(std::move(tagrow)), result(nullptr)
     {
@@ -50,7 +51,7 @@ void InsertNewItemCommand::execute_command()
 {
     auto parent = itemFromPath(p_impl->item_path);
     auto child = p_impl->factory_func().release();
-    setDescription(generate_description(child->modelType(), p_impl->tagrow));
+    p_impl->model_type = child->modelType();
     if (parent->insertItem(child, p_impl->tagrow)) {
         p_impl->result = child;
     } else {
@@ -59,6 +60,11 @@ void InsertNewItemCommand::execute_command()
     }
 }
 
+std::string InsertNewItemCommand::describe_command() const
+{
+    return generate_description(p_impl->model_type, p_impl->tagrow);
+}
+
 InsertNewItemCommand::result_t InsertNewItemCommand::result() const
 {
     return p_impl->result;
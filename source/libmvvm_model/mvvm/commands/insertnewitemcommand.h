@@ -34,6 +34,7 @@ public:
 private:
     void undo_command() override;
     void execute_command() override;
+    std::string describe_command() const override;
 
     struct InsertNewItemCommandImpl;
     std::unique_ptr<InsertNewItemCommandImpl> p_impl;
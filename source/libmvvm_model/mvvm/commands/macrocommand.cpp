@@ -0,0 +1,87 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/commands/macrocommand.h>
+#include <vector>
+
+using namespace ModelView;
+
+struct MacroCommand::MacroCommandImpl {
+    std::vector<std::shared_ptr<AbstractItemCommand>> m_commands;
+    bool m_is_recorded{false}; //! commands were executed while being recorded
+
+    void undo_all()
+    {
+        for (auto it = m_commands.rbegin(); it != m_commands.rend(); ++it)
+            (*it)->undo();
+    }
+};
+
+MacroCommand::MacroCommand(SessionItem* receiver, const std::string& description)
+    : AbstractItemCommand(receiver), p_impl(std::make_unique<MacroCommandImpl>())
+{
+    setDescription(description);
+}
+
+MacroCommand::~MacroCommand() = default;
+
+//! Adds already executed command to the macro. Commands which didn't change anything
+//! (i.e. setting the same value) are dropped.
+
+void MacroCommand::addCommand(std::shared_ptr<AbstractItemCommand> command)
+{
+    if (command->isObsolete())
+        return;
+
+    p_impl->m_commands.emplace_back(std::move(command));
+}
+
+//! Returns number of recorded commands.
+
+int MacroCommand::commandCount() const
+{
+    return static_cast<int>(p_impl->m_commands.size());
+}
+
+//! Undo all recorded commands, which were executed but haven't been committed yet.
+//! The macro becomes obsolete.
+
+void MacroCommand::rollback()
+{
+    p_impl->undo_all();
+    p_impl->m_commands.clear();
+    setObsolete(true);
+}
+
+void MacroCommand::undo_command()
+{
+    p_impl->undo_all();
+}
+
+void MacroCommand::execute_command()
+{
+    setObsolete(p_impl->m_commands.empty());
+
+    // first execution happens during pushing to the undo stack, commands are already executed
+    if (!p_impl->m_is_recorded) {
+        p_impl->m_is_recorded = true;
+        return;
+    }
+
+    for (auto& command : p_impl->m_commands)
+        command->execute();
+}
+
+std::size_t MacroCommand::payload_size() const
+{
+    std::size_t result{0};
+    for (const auto& command : p_impl->m_commands)
+        result += command->byteSize();
+    return result;
+}
@@ -0,0 +1,47 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_COMMANDS_MACROCOMMAND_H
+#define MVVM_COMMANDS_MACROCOMMAND_H
+
+#include <mvvm/commands/abstractitemcommand.h>
+
+namespace ModelView
+{
+
+class SessionItem;
+
+//! Composite command to undo/redo a group of already executed commands as a single unit.
+//! Commands are recorded while being executed one by one, so the first execution of the macro
+//! itself does nothing.
+
+class MVVM_MODEL_EXPORT MacroCommand : public AbstractItemCommand
+{
+public:
+    MacroCommand(SessionItem* receiver, const std::string& description);
+    ~MacroCommand() override;
+
+    void addCommand(std::shared_ptr<AbstractItemCommand> command);
+
+    int commandCount() const;
+
+    void rollback();
+
+private:
+    void undo_command() override;
+    void execute_command() override;
+    std::size_t payload_size() const override;
+
+    struct MacroCommandImpl;
+    std::unique_ptr<MacroCommandImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_COMMANDS_MACROCOMMAND_H
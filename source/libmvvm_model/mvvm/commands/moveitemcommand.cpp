@@ -38,7 +38,6 @@ MoveItemCommand::MoveItemCommand(SessionItem* item, SessionItem* new_parent, Tag
     : AbstractItemCommand(new_parent), p_impl(std::make_unique<MoveItemCommandImpl>(tagrow))
 {
     check_input_data(item, new_parent);
-    setDescription(generate_description(p_impl->target_tagrow));
 
     p_impl->target_parent_path = pathFromItem(new_parent);
     p_impl->original_parent_path = pathFromItem(item->parent());
@@ -95,6 +94,11 @@ void MoveItemCommand::execute_command()
     p_impl->original_parent_path = pathFromItem(original_parent);
 }
 
+std::string MoveItemCommand::describe_command() const
+{
+    return generate_description(p_impl->target_tagrow);
+}
+
 MoveItemCommand::result_t MoveItemCommand::result() const
 {
     return p_impl->result;
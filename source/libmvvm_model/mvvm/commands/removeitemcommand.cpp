@@ -8,6 +8,7 @@
 // ************************************************************************** //
 
 #include <mvvm/commands/removeitemcommand.h>
+#include <mvvm/model/itemutils.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/serialization/itembackupstrategy.h>
@@ -25,6 +26,7 @@ struct RemoveItemCommand::RemoveItemCommandImpl {
     result_t result;
     std::unique_ptr<ItemBackupStrategy> backup_strategy;
     Path item_path;
+    std::size_t backup_size{0}; //! approximate size of the item kept in backup
     RemoveItemCommandImpl(TagRow tagrow) : tagrow(std::move(tagrow)), result(false) {}
 };
 
@@ -32,7 +34,6 @@ RemoveItemCommand::RemoveItemCommand(SessionItem* parent, TagRow tagrow)
     : AbstractItemCommand(parent),
       p_impl(std::make_unique<RemoveItemCommandImpl>(std::move(tagrow)))
 {
-    setDescription(generate_description(p_impl->tagrow));
     p_impl->backup_strategy = parent->model()->itemBackupStrategy();
     p_impl->item_path = pathFromItem(parent);
 }
@@ -43,6 +44,7 @@ void RemoveItemCommand::undo_command()
 {
     auto parent = itemFromPath(p_impl->item_path);
     auto reco_item = p_impl->backup_strategy->restoreItem();
+    p_impl->backup_size = 0;
     parent->insertItem(reco_item.release(), p_impl->tagrow);
 }
 
@@ -50,8 +52,8 @@ void RemoveItemCommand::execute_command()
 {
     auto parent = itemFromPath(p_impl->item_path);
     if (auto child = parent->takeItem(p_impl->tagrow); child) {
-        p_impl->backup_strategy->saveItem(child);
-        delete child;
+        p_impl->backup_size = Utils::ItemByteSize(*child);
+        p_impl->backup_strategy->keepItem(std::unique_ptr<SessionItem>(child));
         p_impl->result = true;
     } else {
         p_impl->result = false;
@@ -59,6 +61,16 @@ void RemoveItemCommand::execute_command()
     }
 }
 
+std::size_t RemoveItemCommand::payload_size() const
+{
+    return sizeof(RemoveItemCommandImpl) + p_impl->backup_size;
+}
+
+std::string RemoveItemCommand::describe_command() const
+{
+    return generate_description(p_impl->tagrow);
+}
+
 RemoveItemCommand::result_t RemoveItemCommand::result() const
 {
     return p_impl->result;
@@ -33,6 +33,8 @@ public:
 private:
     void undo_command() override;
     void execute_command() override;
+    std::size_t payload_size() const override;
+    std::string describe_command() const override;
 
     struct RemoveItemCommandImpl;
     std::unique_ptr<RemoveItemCommandImpl> p_impl;
@@ -7,37 +7,51 @@
 //
 // ************************************************************************** //
 
+#include <algorithm>
+#include <iterator>
 #include <mvvm/commands/setvaluecommand.h>
+#include <mvvm/model/customvariants.h>
 #include <mvvm/model/path.h>
 #include <mvvm/model/sessionitem.h>
 #include <sstream>
 
 namespace
 {
+const int set_value_command_id = 1;
+const int max_text_length = 32; //! longer strings are described by the type name
 std::string generate_description(const std::string& str);
+std::string value_summary(const QVariant& value);
 } // namespace
 
 using namespace ModelView;
 
 struct SetValueCommand::SetValueCommandImpl {
-    QVariant m_value; //! Value to set as a result of command execution.
+    QVariant m_value;             //! Value to set as a result of command execution.
+    std::string m_new_value_text; //! Short text of the value set by the command, for description.
     int m_role;
     result_t m_result;
     Path m_item_path;
-    SetValueCommandImpl(QVariant value, int role)
-        : m_value(std::move(value)), m_role(role), m_result(false)
+    SetValueMergePolicy m_policy;
+    std::chrono::steady_clock::time_point m_timestamp; //! time of last execution
+    SetValueCommandImpl(QVariant value, int role, SetValueMergePolicy policy)
+        : m_value(std::move(value)), m_new_value_text(value_summary(m_value)), m_role(role),
+          m_result(false), m_policy(policy)
     {
     }
+
+    bool is_mergeable() const { return m_policy.window.count() > 0 || m_policy.session != 0; }
 };
 
 // ----------------------------------------------------------------------------
 
-SetValueCommand::SetValueCommand(SessionItem* item, QVariant value, int role)
+SetValueCommand::SetValueCommand(SessionItem* item, QVariant value, int role,
+                                 SetValueMergePolicy policy)
     : AbstractItemCommand(item),
-      p_impl(std::make_unique<SetValueCommandImpl>(std::move(value), role))
+      p_impl(std::make_unique<SetValueCommandImpl>(std::move(value), role, policy))
 {
-    setDescription(generate_description(p_impl->m_value.toString().toStdString()));
     p_impl->m_item_path = pathFromItem(item);
+    if (p_impl->is_mergeable())
+        setMergeId(set_value_command_id);
 }
 
 SetValueCommand::~SetValueCommand() = default;
@@ -50,6 +64,50 @@ void SetValueCommand::undo_command()
 void SetValueCommand::execute_command()
 {
     swap_values();
+    p_impl->m_timestamp = std::chrono::steady_clock::now();
+}
+
+//! Merges other command, which was executed right after this one, if both change the same item
+//! and role and either belong to the same edit session, or were executed within merge window.
+//! The value to restore on undo is kept from this command, so undo rolls back both changes.
+
+bool SetValueCommand::merge_command(const AbstractItemCommand* other)
+{
+    auto command = dynamic_cast<const SetValueCommand*>(other);
+    if (!command)
+        return false;
+
+    const auto& impl = *command->p_impl;
+    if (impl.m_role != p_impl->m_role
+        || !std::equal(impl.m_item_path.begin(), impl.m_item_path.end(),
+                       p_impl->m_item_path.begin(), p_impl->m_item_path.end()))
+        return false;
+
+    const bool same_session = p_impl->m_policy.session != 0
+                              && p_impl->m_policy.session == impl.m_policy.session;
+    const bool within_window = impl.m_policy.window.count() > 0
+                               && impl.m_timestamp - p_impl->m_timestamp <= impl.m_policy.window;
+    if (!same_session && !within_window)
+        return false;
+
+    p_impl->m_timestamp = impl.m_timestamp;
+    p_impl->m_result = impl.m_result;
+    p_impl->m_new_value_text = impl.m_new_value_text;
+    resetDescription();
+    return true;
+}
+
+std::string SetValueCommand::describe_command() const
+{
+    return generate_description(p_impl->m_new_value_text);
+}
+
+std::size_t SetValueCommand::payload_size() const
+{
+    auto path_size = std::distance(p_impl->m_item_path.begin(), p_impl->m_item_path.end());
+    return sizeof(SetValueCommandImpl) + static_cast<std::size_t>(path_size) * sizeof(int)
+           + Utils::VariantByteSize(p_impl->m_value) - sizeof(QVariant)
+           + p_impl->m_new_value_text.size();
 }
 
 void SetValueCommand::swap_values()
@@ -77,4 +135,15 @@ std::string generate_description(const std::string& str)
     ostr << "Set value " << str;
     return ostr.str();
 }
+
+//! Returns text of scalars and short strings, and the type name for everything else. Commands
+//! keep the summary instead of a copy of the value, which might be a large array.
+
+std::string value_summary(const QVariant& value)
+{
+    if (Utils::IsBoolVariant(value) || Utils::IsIntVariant(value) || Utils::IsDoubleVariant(value)
+        || (value.type() == QVariant::String && value.toString().size() <= max_text_length))
+        return value.toString().toStdString();
+    return Utils::VariantName(value);
+}
 } // namespace
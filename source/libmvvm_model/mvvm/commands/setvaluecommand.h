@@ -10,6 +10,7 @@
 #ifndef MVVM_COMMANDS_SETVALUECOMMAND_H
 #define MVVM_COMMANDS_SETVALUECOMMAND_H
 
+#include <chrono>
 #include <mvvm/commands/abstractitemcommand.h>
 
 class QVariant;
@@ -19,13 +20,21 @@ namespace ModelView
 
 class SessionItem;
 
+//! Defines when consecutive SetValueCommand's changing the same item and role are merged.
+
+struct SetValueMergePolicy {
+    std::chrono::milliseconds window{0}; //! max time between commands, 0 disables time merging
+    int session{0};                      //! edit session, commands of the same session are merged
+};
+
 //! Command for unddo/redo framework to set the data of SessionItem.
 
 class MVVM_MODEL_EXPORT SetValueCommand : public AbstractItemCommand
 {
 public:
     using result_t = bool;
-    SetValueCommand(SessionItem* item, QVariant value, int role);
+    SetValueCommand(SessionItem* item, QVariant value, int role,
+                    SetValueMergePolicy policy = {});
     ~SetValueCommand() override;
 
     result_t result() const;
@@ -33,6 +42,9 @@ public:
 private:
     void undo_command() override;
     void execute_command() override;
+    bool merge_command(const AbstractItemCommand* other) override;
+    std::size_t payload_size() const override;
+    std::string describe_command() const override;
     void swap_values();
 
     struct SetValueCommandImpl;
@@ -15,9 +15,18 @@
 namespace ModelView
 {
 
+#ifdef MVVM_BINARY_IDENTIFIERS
+class UniqueId;
+using identifier_type = UniqueId;
+#else
 using identifier_type = std::string;
+#endif
 using model_type = std::string;
 
 } // namespace ModelView
 
+#ifdef MVVM_BINARY_IDENTIFIERS
+#include <mvvm/core/uniqueid.h> // completes identifier_type
+#endif
+
 #endif // MVVM_CORE_TYPES_H
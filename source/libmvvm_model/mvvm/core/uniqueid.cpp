@@ -0,0 +1,115 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/core/uniqueid.h>
+
+using namespace ModelView;
+
+namespace
+{
+const char hex_digits[] = "0123456789abcdef";
+
+//! Length of the identifier in "{xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}" form.
+const size_t braced_length = 38;
+
+//! Length of the identifier in "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" form.
+const size_t plain_length = 36;
+
+//! Positions of dashes in the plain form.
+bool is_dash_position(size_t pos)
+{
+    return pos == 8 || pos == 13 || pos == 18 || pos == 23;
+}
+
+int hex_value(char ch)
+{
+    if (ch >= '0' && ch <= '9')
+        return ch - '0';
+    if (ch >= 'a' && ch <= 'f')
+        return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F')
+        return ch - 'A' + 10;
+    return -1;
+}
+
+} // namespace
+
+//! Returns textual representation of identifier, in the same format as QUuid::toString().
+
+std::string UniqueId::toString() const
+{
+    std::string result(braced_length, '-');
+    result.front() = '{';
+    result.back() = '}';
+
+    size_t pos = 1;
+    auto write_nibbles = [&result, &pos](uint64_t value) {
+        for (int shift = 60; shift >= 0; shift -= 4) {
+            if (is_dash_position(pos - 1))
+                ++pos;
+            result[pos++] = hex_digits[(value >> shift) & 0xF];
+        }
+    };
+    write_nibbles(m_high);
+    write_nibbles(m_low);
+
+    return result;
+}
+
+//! Creates identifier from its textual representation. Both "{...}" and the form without
+//! braces are accepted. Returns null identifier if the string can't be parsed.
+
+UniqueId UniqueId::fromString(const std::string& str)
+{
+    size_t offset = 0;
+    if (str.size() == braced_length) {
+        if (str.front() != '{' || str.back() != '}')
+            return {};
+        offset = 1;
+    } else if (str.size() != plain_length) {
+        return {};
+    }
+
+    uint64_t values[2] = {0, 0};
+    int nibble_count = 0;
+    for (size_t pos = 0; pos < plain_length; ++pos) {
+        const char ch = str[pos + offset];
+        if (is_dash_position(pos)) {
+            if (ch != '-')
+                return {};
+            continue;
+        }
+        const int value = hex_value(ch);
+        if (value < 0)
+            return {};
+        auto& target = values[nibble_count / 16];
+        target = (target << 4) | static_cast<uint64_t>(value);
+        ++nibble_count;
+    }
+
+    return UniqueId(values[0], values[1]);
+}
+
+std::string Utils::IdentifierToString(const identifier_type& id)
+{
+#ifdef MVVM_BINARY_IDENTIFIERS
+    return id.toString();
+#else
+    return id;
+#endif
+}
+
+identifier_type Utils::IdentifierFromString(const std::string& str)
+{
+#ifdef MVVM_BINARY_IDENTIFIERS
+    return UniqueId::fromString(str);
+#else
+    return str;
+#endif
+}
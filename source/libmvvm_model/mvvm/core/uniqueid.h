@@ -0,0 +1,90 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_CORE_UNIQUEID_H
+#define MVVM_CORE_UNIQUEID_H
+
+#include <QMetaType>
+#include <cstdint>
+#include <functional>
+#include <mvvm/core/types.h>
+#include <mvvm/model_export.h>
+#include <string>
+
+namespace ModelView
+{
+
+/*!
+@class UniqueId
+@brief Compact 128-bit value representation of SessionItem identifier.
+
+Holds the same information as the textual identifier "{xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}"
+but can be copied, compared and hashed without allocations. Conversion to/from the textual form
+is lossless. It becomes identifier_type of SessionItem when the library is built with
+MVVM_BINARY_IDENTIFIERS option, files keep identifiers in the textual form in both cases.
+*/
+
+class MVVM_MODEL_EXPORT UniqueId
+{
+public:
+    UniqueId() = default;
+    UniqueId(uint64_t high, uint64_t low) : m_high(high), m_low(low) {}
+
+    uint64_t high() const { return m_high; }
+    uint64_t low() const { return m_low; }
+
+    bool isNull() const { return m_high == 0 && m_low == 0; }
+
+    std::string toString() const;
+
+    static UniqueId fromString(const std::string& str);
+
+    bool operator==(const UniqueId& other) const
+    {
+        return m_high == other.m_high && m_low == other.m_low;
+    }
+    bool operator!=(const UniqueId& other) const { return !(*this == other); }
+    bool operator<(const UniqueId& other) const
+    {
+        return m_high < other.m_high || (m_high == other.m_high && m_low < other.m_low);
+    }
+
+private:
+    uint64_t m_high{0};
+    uint64_t m_low{0};
+};
+
+namespace Utils
+{
+
+//! Returns textual form of item identifier, the one used in files.
+MVVM_MODEL_EXPORT std::string IdentifierToString(const identifier_type& id);
+
+//! Returns item identifier from its textual form. Binary identifier is null if the text can't
+//! be parsed.
+MVVM_MODEL_EXPORT identifier_type IdentifierFromString(const std::string& str);
+
+} // namespace Utils
+
+} // namespace ModelView
+
+Q_DECLARE_METATYPE(ModelView::UniqueId)
+
+namespace std
+{
+template <> struct hash<ModelView::UniqueId> {
+    size_t operator()(const ModelView::UniqueId& id) const noexcept
+    {
+        // identifiers are random, mixing both halves is enough
+        return static_cast<size_t>(id.high() ^ (id.low() * 0x9E3779B97F4A7C15ull));
+    }
+};
+} // namespace std
+
+#endif // MVVM_CORE_UNIQUEID_H
@@ -12,7 +12,30 @@
 
 using namespace ModelView;
 
+//! Returns new identifier of the type used by SessionItem. Textual identifier is formatted in
+//! "{xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}" form, same as QUuid::toString(), directly from the
+//! binary value, without intermediate QString.
+
 identifier_type UniqueIdGenerator::generate()
 {
-    return QUuid::createUuid().toString().toStdString();
+#ifdef MVVM_BINARY_IDENTIFIERS
+    return generateId();
+#else
+    return generateId().toString();
+#endif
+}
+
+//! Returns new identifier in compact binary form.
+
+UniqueId UniqueIdGenerator::generateId()
+{
+    const QUuid uuid = QUuid::createUuid();
+
+    uint64_t high = (static_cast<uint64_t>(uuid.data1) << 32)
+                    | (static_cast<uint64_t>(uuid.data2) << 16) | uuid.data3;
+    uint64_t low(0);
+    for (auto byte : uuid.data4)
+        low = (low << 8) | byte;
+
+    return UniqueId(high, low);
 }
@@ -11,6 +11,7 @@
 #define MVVM_MODEL_UNIQUEIDGENERATOR_H
 
 #include <mvvm/core/types.h>
+#include <mvvm/core/uniqueid.h>
 #include <mvvm/model_export.h>
 
 namespace ModelView
@@ -30,6 +31,8 @@ class MVVM_MODEL_EXPORT UniqueIdGenerator
 {
 public:
     static identifier_type generate();
+
+    static UniqueId generateId();
 };
 
 } // namespace ModelView
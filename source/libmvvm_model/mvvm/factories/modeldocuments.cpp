@@ -8,15 +8,34 @@
 // ************************************************************************** //
 
 #include <mvvm/factories/modeldocuments.h>
+#include <mvvm/serialization/binarydocument.h>
 #include <mvvm/serialization/jsondocument.h>
 
 namespace ModelView
 {
 
 std::unique_ptr<ModelDocumentInterface>
-CreateJsonDocument(std::initializer_list<SessionModel*> models)
+CreateJsonDocument(std::initializer_list<SessionModel*> models, bool use_blob_storage,
+                   bool use_packed_arrays, bool compress_packed_arrays)
 {
-    return std::make_unique<JsonDocument>(models);
+    return std::make_unique<JsonDocument>(models, use_blob_storage, use_packed_arrays,
+                                          compress_packed_arrays);
+}
+
+std::unique_ptr<ModelDocumentInterface>
+CreateBinaryDocument(std::initializer_list<SessionModel*> models)
+{
+    return std::make_unique<BinaryDocument>(models);
+}
+
+std::unique_ptr<ModelDocumentInterface>
+CreateModelDocument(std::initializer_list<SessionModel*> models, DocumentFormat format)
+{
+    if (format == DocumentFormat::BINARY)
+        return CreateBinaryDocument(models);
+    const bool compress = format == DocumentFormat::JSON_PACKED_COMPRESSED;
+    return CreateJsonDocument(models, format == DocumentFormat::JSON_WITH_BLOBS,
+                              format == DocumentFormat::JSON_PACKED || compress, compress);
 }
 
 } // namespace ModelView
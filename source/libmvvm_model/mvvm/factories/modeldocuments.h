@@ -21,7 +21,16 @@ class SessionModel;
 
 //! Creates JsonDocument to save and load models.
 MVVM_MODEL_EXPORT std::unique_ptr<ModelDocumentInterface>
-CreateJsonDocument(std::initializer_list<SessionModel*> models);
+CreateJsonDocument(std::initializer_list<SessionModel*> models, bool use_blob_storage = false,
+                   bool use_packed_arrays = false, bool compress_packed_arrays = false);
+
+//! Creates BinaryDocument to save and load models.
+MVVM_MODEL_EXPORT std::unique_ptr<ModelDocumentInterface>
+CreateBinaryDocument(std::initializer_list<SessionModel*> models);
+
+//! Creates document of given format to save and load models.
+MVVM_MODEL_EXPORT std::unique_ptr<ModelDocumentInterface>
+CreateModelDocument(std::initializer_list<SessionModel*> models, DocumentFormat format);
 
 } // namespace ModelView
 
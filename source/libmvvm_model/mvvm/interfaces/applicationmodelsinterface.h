@@ -10,6 +10,7 @@
 #ifndef MVVM_INTERFACES_APPLICATIONMODELSINTERFACE_H
 #define MVVM_INTERFACES_APPLICATIONMODELSINTERFACE_H
 
+#include <mvvm/interfaces/modeldocumentinterface.h>
 #include <mvvm/model_export.h>
 #include <vector>
 
@@ -26,6 +27,12 @@ class MVVM_MODEL_EXPORT ApplicationModelsInterface
 public:
     //! Returns vector of models intended for saving on disk.
     virtual std::vector<SessionModel*> persistent_models() const = 0;
+
+    //! Returns format of the document to save given model. Models are saved as json by default.
+    virtual DocumentFormat document_format(const SessionModel&) const
+    {
+        return DocumentFormat::JSON;
+    }
 };
 
 } // namespace ModelView
@@ -10,12 +10,22 @@
 #ifndef MVVM_CORE_MODELDOCUMENTINTERFACE_H
 #define MVVM_CORE_MODELDOCUMENTINTERFACE_H
 
+#include <functional>
 #include <mvvm/model_export.h>
 #include <string>
 
+class QIODevice;
+
 namespace ModelView
 {
 
+//! Formats of documents to store models on disk.
+//! JSON_WITH_BLOBS keeps large arrays in binary files in the directory next to the json file.
+//! JSON_PACKED writes large arrays of doubles inside json as base64 of their binary content.
+//! JSON_PACKED_COMPRESSED does the same, but compresses binary content before encoding.
+
+enum class DocumentFormat { JSON, BINARY, JSON_WITH_BLOBS, JSON_PACKED, JSON_PACKED_COMPRESSED };
+
 /*!
 @class ModelDocumentInterface
 @brief Base class to save and restore session models to/from disk.
@@ -31,6 +41,20 @@ public:
 
     virtual void save(const std::string& file_name) const = 0;
     virtual void load(const std::string& file_name) = 0;
+
+    //! Reads the file without touching the models and returns the function to populate them.
+    //! Reading can be done in a worker thread, the function should be called in the thread
+    //! owning the models.
+    virtual std::function<void()> prepare_load(const std::string& file_name)
+    {
+        return [this, file_name]() { load(file_name); };
+    }
+
+    //! Writes models into the given device, e.g. into the memory buffer.
+    virtual void save(QIODevice& device) const = 0;
+
+    //! Reads models from the given device, see prepare_load(file_name).
+    virtual std::function<void()> prepare_load(QIODevice& device) = 0;
 };
 
 } // namespace ModelView
@@ -8,6 +8,7 @@
 // ************************************************************************** //
 
 #include <QMetaType>
+#include <mvvm/core/uniqueid.h>
 #include <mvvm/model/comboproperty.h>
 #include <mvvm/model/comparators.h>
 #include <mvvm/model/customvariants.h>
@@ -26,6 +27,7 @@ void Comparators::registerComparators()
         QMetaType::registerComparators<ComboProperty>();
         QMetaType::registerComparators<ExternalProperty>();
         QMetaType::registerComparators<RealLimits>();
+        QMetaType::registerComparators<UniqueId>();
         m_is_registered = true;
     }
 }
@@ -7,9 +7,11 @@
 //
 // ************************************************************************** //
 
+#include <mvvm/core/uniqueid.h>
 #include <mvvm/model/comboproperty.h>
 #include <mvvm/model/customvariants.h>
 #include <mvvm/model/externalproperty.h>
+#include <mvvm/model/lazydata.h>
 #include <mvvm/model/variant-constants.h>
 
 using namespace ModelView;
@@ -21,10 +23,8 @@ std::string Utils::VariantName(const QVariant& variant)
 
 int Utils::VariantType(const QVariant& variant)
 {
-    auto result = static_cast<int>(variant.type());
-    if (result == QVariant::UserType)
-        result = variant.userType();
-    return result;
+    // userType() coincides with type() for built-in types and resolves user types
+    return variant.userType();
 }
 
 bool Utils::CompatibleVariantTypes(const QVariant& oldValue, const QVariant& newValue)
@@ -120,3 +120,53 @@ bool Utils::IsRealLimitsVariant(const QVariant& variant)
 {
     return variant.canConvert<RealLimits>();
 }
+
+bool Utils::IsLazyDataVariant(const QVariant& variant)
+{
+    return variant.typeName() == Constants::lazydata_type_name;
+}
+
+bool Utils::IsUniqueIdVariant(const QVariant& variant)
+{
+    return variant.typeName() == Constants::uniqueid_type_name;
+}
+
+QVariant Utils::IdentifierVariant(const QVariant& variant)
+{
+#ifdef MVVM_BINARY_IDENTIFIERS
+    if (IsStdStringVariant(variant))
+        return QVariant::fromValue(IdentifierFromString(variant.value<std::string>()));
+#endif
+    return variant;
+}
+
+QVariant Utils::ResolvedVariant(const QVariant& variant)
+{
+    return IsLazyDataVariant(variant) ? variant.value<LazyData>().variant() : variant;
+}
+
+//! Returns approximate number of bytes occupied by variant. Content of LazyData isn't accounted,
+//! since it can be evicted at any moment.
+
+std::size_t Utils::VariantByteSize(const QVariant& variant)
+{
+    std::size_t result = sizeof(QVariant);
+
+    // values are inspected in place, since QVariant::value() would copy the whole array
+    if (IsLazyDataVariant(variant)) {
+        auto lazy_data = static_cast<const LazyData*>(variant.constData());
+        result += sizeof(LazyData) + lazy_data->fileName().size();
+    } else if (IsDoubleVectorVariant(variant)) {
+        auto values = static_cast<const std::vector<double>*>(variant.constData());
+        result += values->size() * sizeof(double);
+    } else if (IsStdStringVariant(variant)) {
+        result += static_cast<const std::string*>(variant.constData())->size();
+    } else if (IsComboVariant(variant)) {
+        for (const auto& str : static_cast<const ComboProperty*>(variant.constData())->values())
+            result += sizeof(std::string) + str.size();
+    } else if (variant.type() == QVariant::String) {
+        result += static_cast<std::size_t>(variant.toString().size()) * sizeof(QChar);
+    }
+
+    return result;
+}
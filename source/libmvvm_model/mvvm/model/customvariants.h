@@ -70,6 +70,24 @@ MVVM_MODEL_EXPORT bool IsExtPropertyVariant(const QVariant& variant);
 //! Returns true in the case of RealLimits based variant.
 MVVM_MODEL_EXPORT bool IsRealLimitsVariant(const QVariant& variant);
 
+//! Returns true in the case of LazyData based variant.
+MVVM_MODEL_EXPORT bool IsLazyDataVariant(const QVariant& variant);
+
+//! Returns true in the case of UniqueId based variant.
+MVVM_MODEL_EXPORT bool IsUniqueIdVariant(const QVariant& variant);
+
+//! Returns variant with item identifier of identifier_type, converting it from the textual form
+//! it has in files if necessary.
+MVVM_MODEL_EXPORT QVariant IdentifierVariant(const QVariant& variant);
+
+//! Returns variant with the content of LazyData, reading it from disk if necessary. Other variants
+//! are returned unchanged.
+MVVM_MODEL_EXPORT QVariant ResolvedVariant(const QVariant& variant);
+
+//! Returns approximate number of bytes occupied by variant, including the content of strings
+//! and arrays it holds.
+MVVM_MODEL_EXPORT std::size_t VariantByteSize(const QVariant& variant);
+
 } // namespace Utils
 } // namespace ModelView
 
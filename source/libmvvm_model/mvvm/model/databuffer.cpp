@@ -0,0 +1,99 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/databuffer.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+DataBuffer::DataBuffer() : DataBuffer(std::vector<double>()) {}
+
+//! Creates new buffer of given size filled with given value.
+
+DataBuffer::DataBuffer(size_t size, double value) : DataBuffer(std::vector<double>(size, value))
+{
+}
+
+//! Creates buffer taking ownership of given values.
+
+DataBuffer::DataBuffer(std::vector<double> values) : m_variant(QVariant::fromValue(values)) {}
+
+//! Creates buffer sharing the array stored in given variant.
+//! Invalid variant gives an empty buffer, variants of other types are not allowed.
+
+DataBuffer::DataBuffer(QVariant variant) : m_variant(std::move(variant))
+{
+    if (!m_variant.isValid())
+        m_variant = QVariant::fromValue(std::vector<double>());
+
+    if (!Utils::IsDoubleVectorVariant(m_variant))
+        throw std::runtime_error("DataBuffer::DataBuffer() -> Error. Variant of type '"
+                                 + Utils::VariantName(m_variant)
+                                 + "' doesn't represent vector of doubles.");
+}
+
+size_t DataBuffer::size() const
+{
+    return values().size();
+}
+
+bool DataBuffer::empty() const
+{
+    return values().empty();
+}
+
+//! Returns pointer to the beginning of the array. No copy is made.
+
+const double* DataBuffer::data() const
+{
+    return values().data();
+}
+
+//! Returns pointer to the beginning of the array for in-place modification.
+//! The array will be copied if it is shared with other buffers or variants.
+
+double* DataBuffer::mutableData()
+{
+    return static_cast<std::vector<double>*>(m_variant.data())->data();
+}
+
+DataBuffer::const_iterator DataBuffer::begin() const
+{
+    return data();
+}
+
+DataBuffer::const_iterator DataBuffer::end() const
+{
+    return data() + size();
+}
+
+double DataBuffer::operator[](size_t index) const
+{
+    return values()[index];
+}
+
+//! Returns copy of the array.
+
+std::vector<double> DataBuffer::toVector() const
+{
+    return values();
+}
+
+//! Returns variant sharing the array with this buffer.
+
+QVariant DataBuffer::variant() const
+{
+    return m_variant;
+}
+
+const std::vector<double>& DataBuffer::values() const
+{
+    return *static_cast<const std::vector<double>*>(m_variant.constData());
+}
@@ -0,0 +1,72 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_DATABUFFER_H
+#define MVVM_MODEL_DATABUFFER_H
+
+#include <QVariant>
+#include <mvvm/model_export.h>
+#include <vector>
+
+namespace ModelView
+{
+
+/*!
+@class DataBuffer
+@brief Ref-counted, copy-on-write buffer of doubles, compatible with std::vector<double> variants.
+
+Wraps QVariant holding std::vector<double>, which is implicitly shared. Copies of the buffer,
+and the variant stored in SessionItem, refer to the same array until one of them is modified.
+Read access is provided via span-style accessors without copying the array. Write access
+detaches the buffer if it is shared.
+
+Typical usage:
+@code
+auto values = data_item->binValuesBuffer(); // no copy
+auto [min, max] = std::minmax_element(values.begin(), values.end());
+
+DataBuffer content(nbins); // new array, not shared with anyone
+std::fill(content.mutableData(), content.mutableData() + content.size(), 1.0); // no detach
+data_item->setContent(content); // stored in item without copying
+@endcode
+*/
+
+class MVVM_MODEL_EXPORT DataBuffer
+{
+public:
+    using const_iterator = const double*;
+
+    DataBuffer();
+    explicit DataBuffer(size_t size, double value = 0.0);
+    explicit DataBuffer(std::vector<double> values);
+    explicit DataBuffer(QVariant variant);
+
+    size_t size() const;
+    bool empty() const;
+
+    const double* data() const;
+    double* mutableData();
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    double operator[](size_t index) const;
+
+    std::vector<double> toVector() const;
+
+    QVariant variant() const;
+
+private:
+    const std::vector<double>& values() const;
+    QVariant m_variant;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_DATABUFFER_H
@@ -20,14 +20,21 @@ size_t ItemPool::size() const
     return m_key_to_item.size();
 }
 
-identifier_type ItemPool::register_item(SessionItem* item, identifier_type key)
+//! Reserves space for given number of registrations to avoid rehashing during bulk insertion.
+
+void ItemPool::reserve(size_t count)
+{
+    m_key_to_item.reserve(count);
+    m_item_to_key.reserve(count);
+}
 
+identifier_type ItemPool::register_item(SessionItem* item, identifier_type key)
 {
     if (m_item_to_key.find(item) != m_item_to_key.end())
         throw std::runtime_error("ItemPool::register_item() -> Attempt to register already "
                                  "registered item.");
 
-    if (key.empty()) {
+    if (key == identifier_type()) {
         key = UniqueIdGenerator::generate();
         while (m_key_to_item.find(key) != m_key_to_item.end())
             key = UniqueIdGenerator::generate(); // preventing improbable duplicates
@@ -36,8 +43,8 @@ identifier_type ItemPool::register_item(SessionItem* item, identifier_type key)
             throw std::runtime_error(" ItemPool::register_item() -> Attempt to reuse existing key");
     }
 
-    m_key_to_item.insert(std::make_pair(key, item));
-    m_item_to_key.insert(std::make_pair(item, key));
+    m_key_to_item.emplace(key, item);
+    m_item_to_key.emplace(item, key);
 
     return key;
 }
@@ -48,11 +55,8 @@ void ItemPool::unregister_item(SessionItem* item)
     if (it == m_item_to_key.end())
         throw std::runtime_error("ItemPool::deregister_item() -> Attempt to deregister "
                                  "non existing item.");
-    auto key = it->second;
+    m_key_to_item.erase(it->second);
     m_item_to_key.erase(it);
-
-    auto it2 = m_key_to_item.find(key);
-    m_key_to_item.erase(it2);
 }
 
 identifier_type ItemPool::key_for_item(SessionItem* item) const
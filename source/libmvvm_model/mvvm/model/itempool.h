@@ -10,9 +10,9 @@
 #ifndef MVVM_MODEL_ITEMPOOL_H
 #define MVVM_MODEL_ITEMPOOL_H
 
-#include <map>
 #include <mvvm/model/mvvm_types.h>
 #include <mvvm/model_export.h>
+#include <unordered_map>
 
 namespace ModelView
 {
@@ -21,6 +21,8 @@ class SessionItem;
 
 //! Provides registration of SessionItem pointers and their unique identifiers
 //! in global memory pool.
+//! Both directions of the lookup are backed by hash maps, so resolving an item by its identifier
+//! (SessionModel::findItem, LinkedItem::get, undo/redo commands) doesn't depend on pool size.
 
 class MVVM_MODEL_EXPORT ItemPool
 {
@@ -33,6 +35,8 @@ public:
 
     size_t size() const;
 
+    void reserve(size_t count);
+
     identifier_type register_item(SessionItem* item, identifier_type key = {});
     void unregister_item(SessionItem* item);
 
@@ -41,8 +45,8 @@ public:
     SessionItem* item_for_key(const identifier_type& key) const;
 
 private:
-    std::map<identifier_type, SessionItem*> m_key_to_item;
-    std::map<SessionItem*, identifier_type> m_item_to_key;
+    std::unordered_map<identifier_type, SessionItem*> m_key_to_item;
+    std::unordered_map<const SessionItem*, identifier_type> m_item_to_key;
 };
 
 } // namespace ModelView
@@ -8,6 +8,7 @@
 // ************************************************************************** //
 
 #include <iterator>
+#include <mvvm/model/customvariants.h>
 #include <mvvm/model/itemutils.h>
 #include <mvvm/model/sessionitem.h>
 
@@ -61,20 +62,12 @@ int Utils::CopyNumber(const SessionItem* item)
 
 SessionItem* Utils::ChildAt(const SessionItem* parent, int index)
 {
-    if (!parent)
-        return nullptr;
-
-    auto container = parent->children();
-    return index >= 0 && static_cast<size_t>(index) < container.size()
-               ? container[static_cast<size_t>(index)]
-               : nullptr;
+    return parent ? parent->childAt(index) : nullptr;
 }
 
 int Utils::IndexOfChild(const SessionItem* parent, const SessionItem* child)
 {
-    auto container = parent->children();
-    auto pos = find(container.begin(), container.end(), child);
-    return pos == container.end() ? -1 : static_cast<int>(std::distance(container.begin(), pos));
+    return parent->indexOfChild(child);
 }
 
 std::vector<SessionItem*> Utils::TopLevelItems(const SessionItem& item)
@@ -131,3 +124,15 @@ bool Utils::IsItemAncestor(const SessionItem* item, const SessionItem* candidate
     }
     return false;
 }
+
+std::size_t Utils::ItemByteSize(const SessionItem& item)
+{
+    std::size_t result{0};
+    iterate_if(&item, [&result](const SessionItem* child) {
+        result += sizeof(SessionItem);
+        for (auto role : child->roles())
+            result += sizeof(int) + VariantByteSize(child->storedData(role));
+        return true;
+    });
+    return result;
+}
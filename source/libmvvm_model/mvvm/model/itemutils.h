@@ -66,6 +66,9 @@ MVVM_MODEL_EXPORT SessionItem* FindNextItemToSelect(SessionItem* item);
 //! Returns true if 'candidate' is one of ancestor of given item.
 MVVM_MODEL_EXPORT bool IsItemAncestor(const SessionItem* item, const SessionItem* candidate);
 
+//! Returns approximate number of bytes occupied by item and all its children, including the data.
+MVVM_MODEL_EXPORT std::size_t ItemByteSize(const SessionItem& item);
+
 } // namespace Utils
 
 } // namespace ModelView
@@ -0,0 +1,329 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QFile>
+#include <QtEndian>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <mvvm/model/lazydata.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+struct LazyData::LazyDataState {
+    std::mutex mutex; //! guards location and content
+    std::string file_name;
+    qint64 offset{0};
+    size_t size{0};
+
+    QVariant content; //! loaded array, invalid if not loaded
+    std::atomic<unsigned long long> last_access{0}; //! access tick, to find cold arrays
+
+    LazyDataState(std::string file_name, qint64 offset, size_t size)
+        : file_name(std::move(file_name)), offset(offset), size(size)
+    {
+    }
+
+    size_t byte_size() const { return size * sizeof(double); }
+};
+
+namespace
+{
+
+//! Keeps track of all handles to enforce memory limit.
+
+struct LazyDataRegistry {
+    std::mutex mutex;
+    std::vector<std::weak_ptr<LazyData::LazyDataState>> states;
+    std::size_t cleanup_size{1024}; //! number of states to trigger removal of expired ones
+    std::size_t memory_limit{std::numeric_limits<std::size_t>::max()};
+    std::atomic<unsigned long long> tick{0};
+};
+
+LazyDataRegistry& registry()
+{
+    static LazyDataRegistry instance;
+    return instance;
+}
+
+//! Returns alive states, removing expired ones from the registry. Registry should be locked.
+
+std::vector<std::shared_ptr<LazyData::LazyDataState>> alive_states(LazyDataRegistry& registry)
+{
+    std::vector<std::shared_ptr<LazyData::LazyDataState>> result;
+    auto is_expired = [&result](const auto& weak_state) {
+        if (auto state = weak_state.lock()) {
+            result.push_back(state);
+            return false;
+        }
+        return true;
+    };
+    registry.states.erase(
+        std::remove_if(registry.states.begin(), registry.states.end(), is_expired),
+        registry.states.end());
+    return result;
+}
+
+//! Adds state to the registry. Expired states are removed each time the registry doubles, so
+//! its size stays proportional to the number of alive handles. Registry should be locked.
+
+void register_state(LazyDataRegistry& registry,
+                    const std::shared_ptr<LazyData::LazyDataState>& state)
+{
+    if (registry.states.size() >= registry.cleanup_size) {
+        auto is_expired = [](const auto& weak_state) { return weak_state.expired(); };
+        registry.states.erase(
+            std::remove_if(registry.states.begin(), registry.states.end(), is_expired),
+            registry.states.end());
+        registry.cleanup_size = std::max(registry.cleanup_size, 2 * registry.states.size());
+    }
+    registry.states.push_back(state);
+}
+
+//! Reads array of given size from the file, starting from given offset.
+
+std::vector<double> read_array(const std::string& file_name, qint64 offset, size_t size)
+{
+    QFile file(QString::fromStdString(file_name));
+    if (!file.open(QIODevice::ReadOnly))
+        throw std::runtime_error("LazyData::read() -> Error. Can't read the file '" + file_name
+                                 + "'.");
+
+    const qint64 byte_count = static_cast<qint64>(size * sizeof(double));
+    if (offset < 0 || file.size() < offset + byte_count)
+        throw std::runtime_error("LazyData::read() -> Error. File '" + file_name
+                                 + "' is too short.");
+
+    std::vector<double> result(size);
+    if (result.empty())
+        return result;
+
+    if (auto mapped = file.map(offset, byte_count)) {
+        qFromLittleEndian<quint64>(mapped, static_cast<qsizetype>(result.size()), result.data());
+        file.unmap(mapped);
+    } else {
+        file.seek(offset);
+        auto bytes = file.read(byte_count);
+        if (bytes.size() != byte_count)
+            throw std::runtime_error("LazyData::read() -> Error. Can't read the file '"
+                                     + file_name + "'.");
+        qFromLittleEndian<quint64>(bytes.constData(), static_cast<qsizetype>(result.size()),
+                                   result.data());
+    }
+
+    return result;
+}
+
+//! Evicts least recently used arrays until the memory limit is satisfied.
+
+void enforce_memory_limit()
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> registry_lock(reg.mutex);
+
+    std::vector<std::shared_ptr<LazyData::LazyDataState>> loaded;
+    std::size_t usage{0};
+    for (auto& state : alive_states(reg)) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->content.isValid()) {
+            usage += state->byte_size();
+            loaded.push_back(state);
+        }
+    }
+
+    if (usage <= reg.memory_limit)
+        return;
+
+    auto is_colder = [](const auto& lhs, const auto& rhs) {
+        return lhs->last_access < rhs->last_access;
+    };
+    std::sort(loaded.begin(), loaded.end(), is_colder);
+    for (auto& state : loaded) {
+        if (usage <= reg.memory_limit)
+            break;
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->content = QVariant();
+        usage -= state->byte_size();
+    }
+}
+
+} // namespace
+
+LazyData::LazyData() = default;
+
+LazyData::LazyData(const std::string& file_name, qint64 offset, size_t size)
+    : m_state(std::make_shared<LazyDataState>(file_name, offset, size))
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    register_state(reg, m_state);
+}
+
+std::string LazyData::fileName() const
+{
+    if (!m_state)
+        return {};
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->file_name;
+}
+
+qint64 LazyData::offset() const
+{
+    if (!m_state)
+        return 0;
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->offset;
+}
+
+size_t LazyData::size() const
+{
+    return m_state ? m_state->size : 0;
+}
+
+bool LazyData::isValid() const
+{
+    return m_state != nullptr;
+}
+
+//! Returns true if the array is currently in memory.
+
+bool LazyData::isLoaded() const
+{
+    if (!m_state)
+        return false;
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->content.isValid();
+}
+
+//! Returns variant with std::vector<double>, reads the array from disk if it is not loaded yet.
+//! Throws if the file can't be read, the handle stays unloaded then.
+
+QVariant LazyData::variant() const
+{
+    if (!m_state)
+        return QVariant();
+
+    QVariant result;
+    bool was_loaded{true};
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        if (!m_state->content.isValid()) {
+            m_state->content = QVariant::fromValue(
+                read_array(m_state->file_name, m_state->offset, m_state->size));
+            was_loaded = false;
+        }
+        result = m_state->content;
+        m_state->last_access = ++registry().tick;
+    }
+
+    // other arrays might need to go to stay within the limit
+    if (!was_loaded)
+        enforce_memory_limit();
+
+    return result;
+}
+
+//! Reads the array from disk, without keeping it in the handle.
+
+std::vector<double> LazyData::read() const
+{
+    if (!m_state)
+        return {};
+
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    const auto file_name = m_state->file_name;
+    const auto offset = m_state->offset;
+    lock.unlock();
+
+    return read_array(file_name, offset, m_state->size);
+}
+
+//! Releases the array, it will be read from disk again on the next access.
+//! The memory is freed when all variants obtained via variant() are gone.
+
+void LazyData::evict()
+{
+    if (!m_state)
+        return;
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->content = QVariant();
+}
+
+//! Makes the handle, and all its copies, refer to the same array in another file. Used when
+//! the array has been written to the new location, i.e. on saving the project under a new name.
+
+void LazyData::relocate(const std::string& file_name, qint64 offset)
+{
+    if (!m_state)
+        return;
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->file_name = file_name;
+    m_state->offset = offset;
+}
+
+bool LazyData::operator==(const LazyData& other) const
+{
+    return fileName() == other.fileName() && offset() == other.offset() && size() == other.size();
+}
+
+bool LazyData::operator!=(const LazyData& other) const
+{
+    return !(*this == other);
+}
+
+//! Sets the limit on the total size of loaded arrays. Least recently used arrays are evicted
+//! immediately, if the limit is exceeded.
+
+void LazyData::setMemoryLimit(std::size_t bytes)
+{
+    {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.memory_limit = bytes;
+    }
+    enforce_memory_limit();
+}
+
+std::size_t LazyData::memoryLimit()
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    return reg.memory_limit;
+}
+
+//! Returns total size of arrays currently held by handles.
+
+std::size_t LazyData::memoryUsage()
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> registry_lock(reg.mutex);
+
+    std::size_t result{0};
+    for (auto& state : alive_states(reg)) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->content.isValid())
+            result += state->byte_size();
+    }
+    return result;
+}
+
+//! Returns true if some handle refers to the given file. Such files shouldn't be removed.
+
+bool LazyData::isFileInUse(const std::string& file_name)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto states = alive_states(reg);
+    return std::any_of(states.begin(), states.end(), [&file_name](const auto& state) {
+        std::lock_guard<std::mutex> state_lock(state->mutex);
+        return state->file_name == file_name;
+    });
+}
@@ -0,0 +1,77 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_LAZYDATA_H
+#define MVVM_MODEL_LAZYDATA_H
+
+#include <QMetaType>
+#include <QVariant>
+#include <memory>
+#include <mvvm/model_export.h>
+#include <string>
+#include <vector>
+
+namespace ModelView
+{
+
+/*!
+@class LazyData
+@brief Handle to array of doubles stored on disk, which is read on first access.
+
+The file contains raw little-endian IEEE doubles starting from given offset. The handle is stored
+in SessionItem in place of std::vector<double> variant. SessionItem::data() resolves it
+transparently, so the array is read (memory-mapped) only when somebody actually looks at it.
+Copies of the handle share the loaded array.
+
+Loaded arrays are accounted in the process-wide memory limit. When the limit is exceeded, least
+recently used arrays are evicted, to be read from disk again on the next access.
+*/
+
+class MVVM_MODEL_EXPORT LazyData
+{
+public:
+    LazyData();
+    LazyData(const std::string& file_name, qint64 offset, size_t size);
+
+    std::string fileName() const;
+    qint64 offset() const;
+    size_t size() const;
+
+    bool isValid() const;
+    bool isLoaded() const;
+
+    QVariant variant() const;
+
+    std::vector<double> read() const;
+
+    void evict();
+
+    void relocate(const std::string& file_name, qint64 offset);
+
+    bool operator==(const LazyData& other) const;
+    bool operator!=(const LazyData& other) const;
+
+    static void setMemoryLimit(std::size_t bytes);
+    static std::size_t memoryLimit();
+    static std::size_t memoryUsage();
+
+    static bool isFileInUse(const std::string& file_name);
+
+    //! State shared by copies of the handle, defined in the implementation.
+    struct LazyDataState;
+
+private:
+    std::shared_ptr<LazyDataState> m_state;
+};
+
+} // namespace ModelView
+
+Q_DECLARE_METATYPE(ModelView::LazyData)
+
+#endif // MVVM_MODEL_LAZYDATA_H
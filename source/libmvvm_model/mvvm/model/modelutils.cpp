@@ -41,3 +41,15 @@ void Utils::MoveDown(SessionItem* item)
         return; // item already at the buttom
     item->model()->moveItem(item, item->parent(), tagrow.next());
 }
+
+//! Replaces content of the model with given top level items. Items are typically built in advance
+//! by the serialization machinery, possibly in another thread.
+
+void Utils::PopulateModel(SessionModel* model, std::vector<std::unique_ptr<SessionItem>> items)
+{
+    auto rebuild_root = [&items](auto parent) {
+        for (auto& item : items)
+            parent->insertItem(item.release(), TagRow::append());
+    };
+    model->clear(rebuild_root);
+}
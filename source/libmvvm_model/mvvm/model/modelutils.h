@@ -13,6 +13,7 @@
 #include <mvvm/model/itemutils.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
+#include <memory>
 #include <mvvm/model_export.h>
 #include <vector>
 
@@ -62,6 +63,8 @@ template <typename T = SessionItem> std::vector<T*> FindItems(const SessionModel
 void MVVM_MODEL_EXPORT DeleteItemFromModel(SessionItem* item);
 void MVVM_MODEL_EXPORT MoveUp(SessionItem* item);
 void MVVM_MODEL_EXPORT MoveDown(SessionItem* item);
+void MVVM_MODEL_EXPORT PopulateModel(SessionModel* model,
+                                     std::vector<std::unique_ptr<SessionItem>> items);
 
 } // namespace Utils
 } // namespace ModelView
@@ -35,20 +35,18 @@ struct SessionItem::SessionItemImpl {
     SessionItem* m_parent{nullptr};
     SessionModel* m_model{nullptr};
     std::unique_ptr<ItemMapper> m_mapper;
-    std::unique_ptr<SessionItemData> m_data;
-    std::unique_ptr<SessionItemTags> m_tags;
+    SessionItemData m_data; //! kept by value to save allocations per item
+    SessionItemTags m_tags;
     model_type m_modelType;
+    const SessionItemContainer* m_container{nullptr}; //! container holding this item
+    int m_row{-1};                                     //! row of this item in the container
 
-    SessionItemImpl(SessionItem* this_item)
-        : m_this_item(this_item), m_data(std::make_unique<SessionItemData>()),
-          m_tags(std::make_unique<SessionItemTags>())
-    {
-    }
+    SessionItemImpl(SessionItem* this_item) : m_this_item(this_item) {}
 
     //! Sets the data for given role, notifies the model.
     bool setData(const QVariant& variant, int role)
     {
-        bool result = m_data->setData(variant, role);
+        bool result = m_data.setData(variant, role);
         if (result && m_model)
             m_model->mapper()->callOnDataChange(m_this_item, role);
         return result;
@@ -87,16 +85,24 @@ SessionItem* SessionItem::setDisplayName(const std::string& name)
     return this;
 }
 
-std::string SessionItem::identifier() const
+identifier_type SessionItem::identifier() const
 {
-    return data<std::string>(ItemDataRole::IDENTIFIER);
+    return data<identifier_type>(ItemDataRole::IDENTIFIER);
 }
 
 //! Returns true if item has data on board with given role.
 
 bool SessionItem::hasData(int role) const
 {
-    return p_impl->m_data->hasData(role);
+    return p_impl->m_data.hasData(role);
+}
+
+//! Returns data for given role as it is stored in the item. Contrary to data(), doesn't read the
+//! content of LazyData from disk.
+
+QVariant SessionItem::storedData(int role) const
+{
+    return p_impl->m_data.storedData(role);
 }
 
 SessionModel* SessionItem::model() const
@@ -111,7 +117,7 @@ SessionItem* SessionItem::parent() const
 
 int SessionItem::childrenCount() const
 {
-    return static_cast<int>(children().size());
+    return p_impl->m_tags.itemCount();
 }
 
 //! Insert item into given tag under the given row.
@@ -129,7 +135,7 @@ bool SessionItem::insertItem(SessionItem* item, const TagRow& tagrow)
     if (item->model())
         throw std::runtime_error("SessionItem::insertItem() -> Existing model.");
 
-    auto result = p_impl->m_tags->insertItem(item, tagrow);
+    auto result = p_impl->m_tags.insertItem(item, tagrow);
     if (result) {
         item->setParent(this);
         item->setModel(model());
@@ -148,13 +154,13 @@ bool SessionItem::insertItem(SessionItem* item, const TagRow& tagrow)
 
 SessionItem* SessionItem::takeItem(const TagRow& tagrow)
 {
-    if (!p_impl->m_tags->canTakeItem(tagrow))
+    if (!p_impl->m_tags.canTakeItem(tagrow))
         return nullptr;
 
     if (p_impl->m_model)
         p_impl->m_model->mapper()->callOnItemAboutToBeRemoved(this, tagrow);
 
-    auto result = p_impl->m_tags->takeItem(tagrow);
+    auto result = p_impl->m_tags.takeItem(tagrow);
     result->setParent(nullptr);
     result->setModel(nullptr);
     // FIXME remaining problem is that ItemMapper still looking to the model
@@ -168,42 +174,58 @@ SessionItem* SessionItem::takeItem(const TagRow& tagrow)
 
 std::vector<SessionItem*> SessionItem::children() const
 {
-    return p_impl->m_tags->allitems();
+    return p_impl->m_tags.allitems();
+}
+
+//! Returns child at given index. No tags are involved, index is considered as global index in the
+//! combined array of all children. Returns nullptr if index is invalid.
+
+SessionItem* SessionItem::childAt(int index) const
+{
+    return p_impl->m_tags.itemAt(index);
+}
+
+//! Returns index of given child in the combined array of all children.
+//! Returns -1 if item doesn't belong to children.
+
+int SessionItem::indexOfChild(const SessionItem* child) const
+{
+    return p_impl->m_tags.indexOfItem(child);
 }
 
 //! Return vector of data roles which this item currently holds.
 
 std::vector<int> SessionItem::roles() const
 {
-    return p_impl->m_data->roles();
+    return p_impl->m_data.roles();
 }
 
 //! Returns the name of the default tag.
 
 std::string SessionItem::defaultTag() const
 {
-    return p_impl->m_tags->defaultTag();
+    return p_impl->m_tags.defaultTag();
 }
 
 //! Sets the default tag.
 
 void SessionItem::setDefaultTag(const std::string& tag)
 {
-    p_impl->m_tags->setDefaultTag(tag);
+    p_impl->m_tags.setDefaultTag(tag);
 }
 
 //! Registers tag to hold items under given name.
 
 void SessionItem::registerTag(const TagInfo& tagInfo, bool set_as_default)
 {
-    p_impl->m_tags->registerTag(tagInfo, set_as_default);
+    p_impl->m_tags.registerTag(tagInfo, set_as_default);
 }
 
 //! Returns true if tag with given name exists.
 
 bool SessionItem::isTag(const std::string& name) const
 {
-    return p_impl->m_tags->isTag(name);
+    return p_impl->m_tags.isTag(name);
 }
 
 //! Returns tag of this item under which it is accessible for its parent.
@@ -224,19 +246,19 @@ TagRow SessionItem::tagRow() const
 
 int SessionItem::itemCount(const std::string& tag) const
 {
-    return p_impl->m_tags->itemCount(tag);
+    return p_impl->m_tags.itemCount(tag);
 }
 
 //! Returns item at given row of given tag.
 
 SessionItem* SessionItem::getItem(const std::string& tag, int row) const
 {
-    return p_impl->m_tags->getItem({tag, row});
+    return p_impl->m_tags.getItem({tag, row});
 }
 
 std::vector<SessionItem*> SessionItem::getItems(const std::string& tag) const
 {
-    return p_impl->m_tags->getItems(tag);
+    return p_impl->m_tags.getItems(tag);
 }
 
 //! Returns tag corresponding to given item.
@@ -252,7 +274,7 @@ std::string SessionItem::tagOfItem(const SessionItem* item) const
 
 TagRow SessionItem::tagRowOfItem(const SessionItem* item) const
 {
-    return p_impl->m_tags->tagRowOfItem(item);
+    return p_impl->m_tags.tagRowOfItem(item);
 }
 
 ItemMapper* SessionItem::mapper()
@@ -262,6 +284,17 @@ ItemMapper* SessionItem::mapper()
     return p_impl->m_mapper.get();
 }
 
+//! Notifies subscribers that the item is gone and destroys the mapper with all subscriptions.
+
+void SessionItem::resetMapper()
+{
+    if (!p_impl->m_mapper)
+        return;
+
+    p_impl->m_mapper->callOnItemDestroy();
+    p_impl->m_mapper.reset();
+}
+
 bool SessionItem::isEditable() const
 {
     return appearance(*this) & Appearance::EDITABLE;
@@ -286,7 +319,7 @@ void SessionItem::setEnabled(bool value)
 
 bool SessionItem::isSinglePropertyTag(const std::string& tag) const
 {
-    return p_impl->m_tags->isSinglePropertyTag(tag);
+    return p_impl->m_tags.isSinglePropertyTag(tag);
 }
 
 //! Sets the data for given role.
@@ -302,7 +335,7 @@ bool SessionItem::set_data_internal(QVariant value, int role)
 
 QVariant SessionItem::data_internal(int role) const
 {
-    return p_impl->m_data->data(role);
+    return p_impl->m_data.data(role);
 }
 
 void SessionItem::setParent(SessionItem* parent)
@@ -335,21 +368,44 @@ void SessionItem::setAppearanceFlag(int flag, bool value)
     setData(flags, ItemDataRole::APPEARANCE);
 }
 
+//! Sets the position of this item in the container of its parent.
+//! Called by SessionItemContainer on every change of the item's row.
+
+void SessionItem::setContainerPosition(const SessionItemContainer* container, int row)
+{
+    p_impl->m_container = container;
+    p_impl->m_row = row;
+}
+
+//! Returns container holding this item, or nullptr if the item doesn't belong to any container.
+
+const SessionItemContainer* SessionItem::ownerContainer() const
+{
+    return p_impl->m_container;
+}
+
+//! Returns row of this item in its container.
+
+int SessionItem::rowInContainer() const
+{
+    return p_impl->m_row;
+}
+
 SessionItemData* SessionItem::itemData() const
 {
-    return p_impl->m_data.get();
+    return &p_impl->m_data;
 }
 
 SessionItemTags* SessionItem::itemTags() const
 {
-    return p_impl->m_tags.get();
+    return &p_impl->m_tags;
 }
 
 void SessionItem::setDataAndTags(std::unique_ptr<SessionItemData> data,
                                  std::unique_ptr<SessionItemTags> tags)
 {
-    p_impl->m_data = std::move(data);
-    p_impl->m_tags = std::move(tags);
+    p_impl->m_data = std::move(*data);
+    p_impl->m_tags = std::move(*tags);
 }
 
 bool SessionItem::setDataIntern(const QVariant& variant, int role)
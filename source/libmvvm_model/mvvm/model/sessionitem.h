@@ -26,6 +26,7 @@ namespace ModelView
 class SessionModel;
 class TagInfo;
 class ItemMapper;
+class SessionItemContainer;
 
 class MVVM_MODEL_EXPORT SessionItem
 {
@@ -40,7 +41,7 @@ public:
     virtual std::string displayName() const;
     virtual SessionItem* setDisplayName(const std::string& name);
 
-    std::string identifier() const;
+    identifier_type identifier() const;
 
     template <typename T> bool setData(const T& value, int role = ItemDataRole::DATA);
     bool setDataIntern(const QVariant& variant, int role);
@@ -49,6 +50,8 @@ public:
 
     template <typename T> T data(int role = ItemDataRole::DATA) const;
 
+    QVariant storedData(int role = ItemDataRole::DATA) const;
+
     SessionModel* model() const;
 
     SessionItem* parent() const;
@@ -61,6 +64,10 @@ public:
 
     std::vector<SessionItem*> children() const;
 
+    SessionItem* childAt(int index) const;
+
+    int indexOfChild(const SessionItem* child) const;
+
     std::vector<int> roles() const;
 
     // tags
@@ -103,12 +110,20 @@ public:
 private:
     friend class SessionModel;
     friend class JsonItemConverter;
+    friend class BinaryItemConverter;
+    friend class SessionItemContainer;
+    friend class DetachedItemBackupStrategy;
+    friend class CloneItemCopyStrategy;
     virtual void activate() {}
     bool set_data_internal(QVariant value, int role);
     QVariant data_internal(int role) const;
     void setParent(SessionItem* parent);
     void setModel(SessionModel* model);
     void setAppearanceFlag(int flag, bool value);
+    void resetMapper();
+    void setContainerPosition(const SessionItemContainer* container, int row);
+    const SessionItemContainer* ownerContainer() const;
+    int rowInContainer() const;
 
     // FIXME refactor converter access to item internals
     class SessionItemData* itemData() const;
@@ -9,7 +9,6 @@
 
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionitemcontainer.h>
-#include <mvvm/utils/containerutils.h>
 
 using namespace ModelView;
 
@@ -53,6 +52,7 @@ bool SessionItemContainer::insertItem(SessionItem* item, int index)
         return false;
 
     m_items.insert(std::next(m_items.begin(), index), item);
+    update_positions(index);
     return true;
 }
 
@@ -64,8 +64,11 @@ SessionItem* SessionItemContainer::takeItem(int index)
         return nullptr;
 
     SessionItem* result = itemAt(index);
-    if (result)
+    if (result) {
         m_items.erase(std::next(m_items.begin(), index));
+        result->setContainerPosition(nullptr, -1);
+        update_positions(index);
+    }
 
     return result;
 }
@@ -91,7 +94,7 @@ bool SessionItemContainer::canInsertItem(const SessionItem* item, int index) con
 
 int SessionItemContainer::indexOfItem(const SessionItem* item) const
 {
-    return Utils::IndexOfItem(m_items, item);
+    return item && item->ownerContainer() == this ? item->rowInContainer() : -1;
 }
 
 //! Returns item at given index. Returns nullptr if index is invalid.
@@ -143,3 +146,11 @@ bool SessionItemContainer::is_valid_item(const SessionItem* item) const
 {
     return item && m_tag_info.isValidChild(item->modelType());
 }
+
+//! Updates cached rows of all items starting from given index.
+
+void SessionItemContainer::update_positions(int first_index)
+{
+    for (size_t row = static_cast<size_t>(first_index); row < m_items.size(); ++row)
+        m_items[row]->setContainerPosition(this, static_cast<int>(row));
+}
@@ -20,6 +20,8 @@ namespace ModelView
 class SessionItem;
 
 //! Holds collection of SessionItem objects related to the same tag.
+//! The container keeps every item informed about its current row, so the position of an item
+//! can be found without searching.
 
 class MVVM_MODEL_EXPORT SessionItemContainer
 {
@@ -60,6 +62,7 @@ private:
     bool maximum_reached() const;
     bool minimum_reached() const;
     bool is_valid_item(const SessionItem* item) const;
+    void update_positions(int first_index);
     TagInfo m_tag_info;
     container_t m_items;
 };
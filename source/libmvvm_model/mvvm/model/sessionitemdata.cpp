@@ -9,27 +9,69 @@
 
 #include <algorithm>
 #include <mvvm/model/customvariants.h>
+#include <mvvm/model/lazydata.h>
 #include <mvvm/model/sessionitemdata.h>
 #include <sstream>
 #include <stdexcept>
 
 using namespace ModelView;
 
+namespace
+{
+const short no_position = -1;
+
+bool is_indexed_role(int role, int indexed_roles_count)
+{
+    return role >= 0 && role < indexed_roles_count;
+}
+
+//! Returns variant representing the type of the value, as it is seen by the user of the item.
+//! LazyData stands for std::vector<double>.
+QVariant type_representative(const QVariant& variant)
+{
+    return Utils::IsLazyDataVariant(variant) ? QVariant::fromValue(std::vector<double>())
+                                             : variant;
+}
+} // namespace
+
+SessionItemData::SessionItemData()
+{
+    m_positions.fill(no_position);
+}
+
 std::vector<int> SessionItemData::roles() const
 {
     std::vector<int> result;
+    result.reserve(m_values.size());
     for (const auto& value : m_values)
         result.push_back(value.m_role);
     return result;
 }
 
+//! Returns data for given role. LazyData is resolved into the array it refers to. If the array
+//! can't be read from disk, array of zeros of the same size is returned, so the size still
+//! matches other arrays of the item. The read is retried on the next access.
+
 QVariant SessionItemData::data(int role) const
 {
-    for (const auto& value : m_values) {
-        if (value.m_role == role)
-            return value.m_data;
+    auto result = storedData(role);
+    if (!Utils::IsLazyDataVariant(result))
+        return result;
+
+    const auto lazy_data = result.value<LazyData>();
+    try {
+        return lazy_data.variant();
+    } catch (const std::runtime_error&) {
+        return QVariant::fromValue(std::vector<double>(lazy_data.size()));
     }
-    return QVariant();
+}
+
+//! Returns data for given role as it is stored, without resolving LazyData.
+
+QVariant SessionItemData::storedData(int role) const
+{
+    const int pos = position_of_role(role);
+    return pos == no_position ? QVariant() : m_values[static_cast<size_t>(pos)].m_data;
 }
 
 //! Sets the data for given role. Returns true if data was changed.
@@ -37,21 +79,27 @@ QVariant SessionItemData::data(int role) const
 
 bool SessionItemData::setData(const QVariant& value, int role)
 {
-    assure_validity(value, role);
-
-    for (auto it = m_values.begin(); it != m_values.end(); ++it) {
-        if (it->m_role == role) {
-            if (value.isValid()) {
-                if (Utils::IsTheSame(it->m_data, value))
-                    return false;
-                it->m_data = value;
-            } else {
-                m_values.erase(it);
-            }
-            return true;
-        }
+    const int pos = position_of_role(role);
+
+    if (pos == no_position) {
+        assure_validity(QVariant(), value);
+        m_values.push_back(DataRole(value, role));
+        if (is_indexed_role(role, indexed_roles_count))
+            m_positions[static_cast<size_t>(role)] = static_cast<short>(m_values.size() - 1);
+        return true;
+    }
+
+    auto it = std::next(m_values.begin(), pos);
+    assure_validity(it->m_data, value);
+
+    if (value.isValid()) {
+        if (Utils::IsTheSame(it->m_data, value))
+            return false;
+        it->m_data = value;
+    } else {
+        m_values.erase(it);
+        update_positions();
     }
-    m_values.push_back(DataRole(value, role));
     return true;
 }
 
@@ -69,22 +117,47 @@ SessionItemData::const_iterator SessionItemData::end() const
 
 bool SessionItemData::hasData(int role) const
 {
-    auto has_role = [role](const auto& x) { return x.m_role == role; };
-    return std::find_if(m_values.begin(), m_values.end(), has_role) != m_values.end();
+    return position_of_role(role) != no_position;
 }
 
-//! Check if variant is compatible
+//! Check if new variant is compatible with the old one. Types are compared via their
+//! integer identifiers.
 
-void SessionItemData::assure_validity(const QVariant& variant, int role)
+void SessionItemData::assure_validity(const QVariant& old_variant,
+                                      const QVariant& new_variant) const
 {
-    if (variant.typeName() == QStringLiteral("QString"))
+    if (new_variant.userType() == QMetaType::QString)
         throw std::runtime_error("Attempt to set QString based variant");
 
-    if (!Utils::CompatibleVariantTypes(data(role), variant)) {
+    if (!Utils::CompatibleVariantTypes(type_representative(old_variant),
+                                       type_representative(new_variant))) {
         std::ostringstream ostr;
         ostr << "SessionItemData::assure_validity() -> Error. Variant types mismatch. "
-             << "Old variant type '" << data(role).typeName() << "' "
-             << "new variant type '" << variant.typeName() << "\n";
+             << "Old variant type '" << old_variant.typeName() << "' "
+             << "new variant type '" << new_variant.typeName() << "\n";
         throw std::runtime_error(ostr.str());
     }
 }
+
+//! Returns position of given role in the container of values, or -1 if no such role exists.
+
+int SessionItemData::position_of_role(int role) const
+{
+    if (is_indexed_role(role, indexed_roles_count))
+        return m_positions[static_cast<size_t>(role)];
+
+    auto has_role = [role](const auto& x) { return x.m_role == role; };
+    auto it = std::find_if(m_values.begin(), m_values.end(), has_role);
+    return it == m_values.end() ? no_position
+                                : static_cast<int>(std::distance(m_values.begin(), it));
+}
+
+//! Rebuilds table of positions of indexed roles after removal of values.
+
+void SessionItemData::update_positions()
+{
+    m_positions.fill(no_position);
+    for (size_t pos = 0; pos < m_values.size(); ++pos)
+        if (int role = m_values[pos].m_role; is_indexed_role(role, indexed_roles_count))
+            m_positions[static_cast<size_t>(role)] = static_cast<short>(pos);
+}
@@ -10,6 +10,7 @@
 #ifndef MVVM_MODEL_SESSIONITEMDATA_H
 #define MVVM_MODEL_SESSIONITEMDATA_H
 
+#include <array>
 #include <mvvm/model/datarole.h>
 #include <mvvm/model_export.h>
 #include <vector>
@@ -18,6 +19,8 @@ namespace ModelView
 {
 
 //! Handles data roles for SessionItem.
+//! Values are kept in insertion order. Positions of built-in roles (see ItemDataRole) are indexed
+//! in a fixed table, so their lookup doesn't require scanning; custom roles are searched linearly.
 
 class MVVM_MODEL_EXPORT SessionItemData
 {
@@ -25,10 +28,14 @@ public:
     using container_type = std::vector<DataRole>;
     using const_iterator = container_type::const_iterator;
 
+    SessionItemData();
+
     std::vector<int> roles() const;
 
     QVariant data(int role) const;
 
+    QVariant storedData(int role) const;
+
     bool setData(const QVariant& value, int role);
 
     const_iterator begin() const;
@@ -37,8 +44,15 @@ public:
     bool hasData(int role) const;
 
 private:
-    void assure_validity(const QVariant& variant, int role);
+    //! Number of roles with indexed position, covers all built-in roles with some headroom.
+    static const int indexed_roles_count = 8;
+
+    void assure_validity(const QVariant& old_variant, const QVariant& new_variant) const;
+    int position_of_role(int role) const;
+    void update_positions();
+
     container_type m_values;
+    std::array<short, indexed_roles_count> m_positions;
 };
 
 } // namespace ModelView
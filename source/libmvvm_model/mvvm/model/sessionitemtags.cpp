@@ -21,13 +21,31 @@ SessionItemTags::~SessionItemTags()
         delete tag;
 }
 
+//! Takes over containers of other tags, own containers are deleted together with their items.
+
+SessionItemTags& SessionItemTags::operator=(SessionItemTags&& other)
+{
+    if (this != &other) {
+        for (auto tag : m_containers)
+            delete tag;
+        m_containers = std::move(other.m_containers);
+        m_name_to_container = std::move(other.m_name_to_container);
+        m_default_tag = std::move(other.m_default_tag);
+        other.m_containers.clear();
+        other.m_name_to_container.clear();
+    }
+    return *this;
+}
+
 void SessionItemTags::registerTag(const TagInfo& tagInfo, bool set_as_default)
 {
     if (isTag(tagInfo.name()))
         throw std::runtime_error("SessionItemTags::registerTag() -> Error. Existing name '"
                                  + tagInfo.name() + "'");
 
-    m_containers.push_back(new SessionItemContainer(tagInfo));
+    auto container = new SessionItemContainer(tagInfo);
+    m_containers.push_back(container);
+    m_name_to_container.emplace(tagInfo.name(), container);
     if (set_as_default)
         m_default_tag = tagInfo.name();
 }
@@ -36,10 +54,7 @@ void SessionItemTags::registerTag(const TagInfo& tagInfo, bool set_as_default)
 
 bool SessionItemTags::isTag(const std::string& name) const
 {
-    for (auto tag : m_containers)
-        if (tag->name() == name)
-            return true;
-    return false;
+    return find_container(name) != nullptr;
 }
 
 //! Returns the name of the default tag.
@@ -59,6 +74,16 @@ int SessionItemTags::itemCount(const std::string& tag_name) const
     return container(tag_name)->itemCount();
 }
 
+//! Returns total number of items in all containers.
+
+int SessionItemTags::itemCount() const
+{
+    int result(0);
+    for (auto cont : m_containers)
+        result += cont->itemCount();
+    return result;
+}
+
 //! Inserts item in container with given tag name and at given row.
 //! Returns true in the case of success. If tag name is empty, default tag will be used.
 
@@ -66,7 +91,7 @@ bool SessionItemTags::insertItem(SessionItem* item, const TagRow& tagrow)
 {
     auto tag_container = container(tagrow.tag);
     auto row = tagrow.row < 0 ? tag_container->itemCount() : tagrow.row;
-    return container(tagrow.tag)->insertItem(item, row);
+    return tag_container->insertItem(item, row);
 }
 
 //! Removes item at given row and for given tag, returns it to the user.
@@ -101,6 +126,7 @@ std::vector<SessionItem*> SessionItemTags::getItems(const std::string& tag) cons
 std::vector<SessionItem*> SessionItemTags::allitems() const
 {
     std::vector<SessionItem*> result;
+    result.reserve(static_cast<size_t>(itemCount()));
     for (auto cont : m_containers) {
         auto container_items = cont->items();
         result.insert(result.end(), container_items.begin(), container_items.end());
@@ -109,6 +135,38 @@ std::vector<SessionItem*> SessionItemTags::allitems() const
     return result;
 }
 
+//! Returns item at given index in the combined array of items from all containers.
+//! Returns nullptr if index is invalid.
+
+SessionItem* SessionItemTags::itemAt(int index) const
+{
+    if (index < 0)
+        return nullptr;
+
+    for (auto cont : m_containers) {
+        if (index < cont->itemCount())
+            return cont->itemAt(index);
+        index -= cont->itemCount();
+    }
+
+    return nullptr;
+}
+
+//! Returns index of item in the combined array of items from all containers.
+//! Returns -1 if item doesn't belong to any container.
+
+int SessionItemTags::indexOfItem(const SessionItem* item) const
+{
+    int offset(0);
+    for (auto cont : m_containers) {
+        if (int row = cont->indexOfItem(item); row != -1)
+            return offset + row;
+        offset += cont->itemCount();
+    }
+
+    return -1;
+}
+
 //! Returns tag name and row of item in container.
 
 TagRow SessionItemTags::tagRowOfItem(const SessionItem* item) const
@@ -145,7 +203,7 @@ bool SessionItemTags::isSinglePropertyTag(const std::string& tag) const
 
 SessionItemContainer* SessionItemTags::container(const std::string& tag_name) const
 {
-    std::string tagName = tag_name.empty() ? defaultTag() : tag_name;
+    const std::string& tagName = tag_name.empty() ? m_default_tag : tag_name;
     auto container = find_container(tagName);
     if (!container)
         throw std::runtime_error("SessionItemTags::container() -> Error. No such container '"
@@ -158,9 +216,6 @@ SessionItemContainer* SessionItemTags::container(const std::string& tag_name) co
 
 SessionItemContainer* SessionItemTags::find_container(const std::string& tag_name) const
 {
-    for (auto cont : m_containers)
-        if (cont->name() == tag_name)
-            return cont;
-
-    return nullptr;
+    auto it = m_name_to_container.find(tag_name);
+    return it == m_name_to_container.end() ? nullptr : it->second;
 }
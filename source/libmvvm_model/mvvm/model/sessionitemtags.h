@@ -13,6 +13,7 @@
 #include <mvvm/model/tagrow.h>
 #include <mvvm/model_export.h>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ModelView
@@ -23,6 +24,8 @@ class TagInfo;
 class SessionItem;
 
 //! Collection of SessionItem's containers according to their tags.
+//! Containers are kept in registration order, the additional index provides access to the
+//! container by tag name without scanning.
 
 class MVVM_MODEL_EXPORT SessionItemTags
 {
@@ -34,6 +37,7 @@ public:
     ~SessionItemTags();
     SessionItemTags(const SessionItemTags&) = delete;
     SessionItemTags& operator=(const SessionItemTags&) = delete;
+    SessionItemTags& operator=(SessionItemTags&& other);
 
     // tag
 
@@ -47,6 +51,8 @@ public:
 
     int itemCount(const std::string& tag_name) const;
 
+    int itemCount() const;
+
     // adding and removal
 
     bool insertItem(SessionItem* item, const TagRow& tagrow);
@@ -62,6 +68,10 @@ public:
 
     std::vector<SessionItem*> allitems() const;
 
+    SessionItem* itemAt(int index) const;
+
+    int indexOfItem(const SessionItem* item) const;
+
     TagRow tagRowOfItem(const SessionItem* item) const;
 
     const_iterator begin() const;
@@ -73,6 +83,7 @@ private:
     SessionItemContainer* container(const std::string& tag_name) const;
     SessionItemContainer* find_container(const std::string& tag_name) const;
     std::vector<SessionItemContainer*> m_containers;
+    std::unordered_map<std::string, SessionItemContainer*> m_name_to_container;
     std::string m_default_tag;
 };
 
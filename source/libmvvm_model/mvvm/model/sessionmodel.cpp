@@ -18,8 +18,8 @@
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/model/taginfo.h>
 #include <mvvm/model/tagrow.h>
-#include <mvvm/serialization/jsonitembackupstrategy.h>
-#include <mvvm/serialization/jsonitemcopystrategy.h>
+#include <mvvm/serialization/cloneitemcopystrategy.h>
+#include <mvvm/serialization/detacheditembackupstrategy.h>
 #include <mvvm/signals/modelmapper.h>
 #include <mvvm/standarditems/standarditemcatalogue.h>
 
@@ -125,6 +125,78 @@ QUndoStack* SessionModel::undoStack() const
     return m_commands->undoStack();
 }
 
+//! Sets time window in milliseconds to merge consecutive changes of the same item's data into
+//! single undo command. Value 0 (default) disables merging.
+
+void SessionModel::setUndoMergeWindow(int msec)
+{
+    m_commands->setMergeWindow(msec);
+}
+
+//! Sets approximate memory budget in bytes for the undo stack. Oldest commands are evicted when
+//! the budget is exceeded. Value 0 (default) means that there is no limit.
+//! Evicted commands remain in the stack as no-op entries, see CommandService::setUndoMemoryLimit.
+
+void SessionModel::setUndoMemoryLimit(std::size_t bytes)
+{
+    m_commands->setUndoMemoryLimit(bytes);
+}
+
+//! Returns approximate number of bytes occupied by the undo stack.
+
+std::size_t SessionModel::undoMemoryUsage() const
+{
+    return m_commands->undoMemoryUsage();
+}
+
+//! Brings the model to the state corresponding to given position in the undo stack. Data change
+//! notifications are emitted once per changed item, after the position is reached.
+
+void SessionModel::setUndoIndex(int index)
+{
+    m_commands->setUndoIndex(index);
+}
+
+//! Starts edit session. All consecutive changes of the same item's data until the end of the
+//! session will be merged into single undo command.
+
+void SessionModel::beginEditSession()
+{
+    m_commands->beginEditSession();
+}
+
+//! Finishes edit session.
+
+void SessionModel::endEditSession()
+{
+    m_commands->endEditSession();
+}
+
+//! Starts transaction. All following changes of the model will be recorded and can be either
+//! committed as a single undo command with given description, or rolled back.
+//! Only data change notifications are postponed till the end of the transaction. Insert and
+//! remove notifications are emitted immediately, so listeners can see changes which will be
+//! rolled back later.
+
+void SessionModel::beginTransaction(const std::string& description)
+{
+    m_commands->beginTransaction(description);
+}
+
+//! Commits transaction. All changes made since its start become a single undo command.
+
+void SessionModel::commitTransaction()
+{
+    m_commands->commitTransaction();
+}
+
+//! Rolls back all changes made since the start of the transaction.
+
+void SessionModel::rollbackTransaction()
+{
+    m_commands->rollbackTransaction();
+}
+
 //! Removes given row from parent.
 
 void SessionModel::removeItem(SessionItem* parent, const TagRow& tagrow)
@@ -169,19 +241,21 @@ void SessionModel::clear(std::function<void(SessionItem*)> callback)
 }
 
 //! Returns strategy suitable for saving/restoring SessionItem.
-//! Restored item will have same identifiers as original.
+//! Restored item will have same identifiers as original. Default strategy keeps removed items
+//! detached from the model. Models can override it, i.e. to use JsonItemBackupStrategy.
 
 std::unique_ptr<ItemBackupStrategy> SessionModel::itemBackupStrategy() const
 {
-    return std::make_unique<JsonItemBackupStrategy>(factory());
+    return std::make_unique<DetachedItemBackupStrategy>(factory());
 }
 
 //! Returns strategy for copying items.
-//! Identifiers of the copy will be different from identifiers of the original.
+//! Identifiers of the copy will be different from identifiers of the original. Default strategy
+//! clones items directly. Models can override it, i.e. to use JsonItemCopyStrategy.
 
 std::unique_ptr<ItemCopyStrategy> SessionModel::itemCopyStrategy() const
 {
-    return std::make_unique<JsonItemCopyStrategy>(factory());
+    return std::make_unique<CloneItemCopyStrategy>(factory());
 }
 
 //! Returns pointer to ItemFactory which can generate all items supported by this model,
@@ -212,3 +286,32 @@ SessionItem* SessionModel::intern_insert(const item_factory_func_t& func, Sessio
 {
     return m_commands->insertNewItem(func, parent, tagrow);
 }
+
+SessionModel::TransactionGuard::TransactionGuard(SessionModel* model,
+                                                 const std::string& description)
+    : m_model(model)
+{
+    m_model->beginTransaction(description);
+}
+
+//! Rolls back the transaction, if it wasn't committed. Exceptions thrown during the rollback are
+//! not propagated, since the guard is often destroyed during stack unwinding.
+
+SessionModel::TransactionGuard::~TransactionGuard() noexcept
+{
+    if (!m_is_active)
+        return;
+
+    try {
+        m_model->rollbackTransaction();
+    } catch (...) {
+    }
+}
+
+//! Commits transaction.
+
+void SessionModel::TransactionGuard::commit()
+{
+    m_is_active = false;
+    m_model->commitTransaction();
+}
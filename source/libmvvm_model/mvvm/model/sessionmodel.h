@@ -66,6 +66,43 @@ public:
 
     QUndoStack* undoStack() const;
 
+    void setUndoMergeWindow(int msec);
+
+    void setUndoMemoryLimit(std::size_t bytes);
+
+    std::size_t undoMemoryUsage() const;
+
+    void setUndoIndex(int index);
+
+    void beginEditSession();
+
+    void endEditSession();
+
+    void beginTransaction(const std::string& description = {});
+
+    void commitTransaction();
+
+    void rollbackTransaction();
+
+    //! Starts transaction on construction, rolls it back on destruction unless it was committed.
+    //! Guarantees that the model stays intact if an exception is thrown in the middle of
+    //! a complex change.
+    class MVVM_MODEL_EXPORT TransactionGuard
+    {
+    public:
+        explicit TransactionGuard(SessionModel* model, const std::string& description = {});
+        ~TransactionGuard() noexcept;
+
+        TransactionGuard(const TransactionGuard& other) = delete;
+        TransactionGuard& operator=(const TransactionGuard& other) = delete;
+
+        void commit();
+
+    private:
+        SessionModel* m_model{nullptr};
+        bool m_is_active{true};
+    };
+
     void removeItem(SessionItem* parent, const TagRow& tagrow);
 
     void moveItem(SessionItem* item, SessionItem* new_parent, const TagRow& tagrow);
@@ -77,9 +114,9 @@ public:
 
     void clear(std::function<void(SessionItem*)> callback = {});
 
-    std::unique_ptr<ItemBackupStrategy> itemBackupStrategy() const;
+    virtual std::unique_ptr<ItemBackupStrategy> itemBackupStrategy() const;
 
-    std::unique_ptr<ItemCopyStrategy> itemCopyStrategy() const;
+    virtual std::unique_ptr<ItemCopyStrategy> itemCopyStrategy() const;
 
     const ItemFactoryInterface* factory() const;
 
@@ -30,6 +30,8 @@ const std::string comboproperty_type_name = "ModelView::ComboProperty";
 const std::string qcolor_type_name = "QColor";
 const std::string extproperty_type_name = "ModelView::ExternalProperty";
 const std::string reallimits_type_name = "ModelView::RealLimits";
+const std::string lazydata_type_name = "ModelView::LazyData";
+const std::string uniqueid_type_name = "ModelView::UniqueId";
 
 } // namespace Constants
 
@@ -7,19 +7,26 @@
 //
 // ************************************************************************** //
 
+#include <QBuffer>
+#include <algorithm>
 #include <functional>
+#include <future>
 #include <mvvm/factories/modeldocuments.h>
 #include <mvvm/interfaces/applicationmodelsinterface.h>
 #include <mvvm/project/project.h>
+#include <mvvm/project/projectarchive.h>
 #include <mvvm/project/projectchangecontroller.h>
 #include <mvvm/project/projectutils.h>
 #include <mvvm/utils/fileutils.h>
+#include <stdexcept>
+#include <type_traits>
 
 using namespace ModelView;
 
 struct Project::ProjectImpl {
     ApplicationModelsInterface* app_models{nullptr};
-    std::string project_dir;
+    std::string project_dir; //! project directory, or archive file if 'is_archive' is set
+    bool is_archive{false};
     ProjectChangedController change_controller;
 
     ProjectImpl(ApplicationModelsInterface* app_models, callback_t callback)
@@ -30,22 +37,192 @@ struct Project::ProjectImpl {
     //! Returns list of models which are subject to save/load.
     std::vector<SessionModel*> models() const { return app_models->persistent_models(); }
 
-    //! Processes all models one by one and either save or load them to/from given directory.
-    //! Template parameter `method` specifies ModelDocumentInterface's method to use.
-    template <typename T> bool process(const std::string& dirname, T method)
+    //! Saves all models to given directory. Each model is written into its own file in a separate
+    //! worker thread, the models are only read while the calling thread waits for the result.
+    //! When saving into the current project directory, only changed models are written.
+    bool save(const std::string& dirname)
     {
-        if (!Utils::exists(dirname))
+        if (!Utils::is_directory(dirname))
             return false;
 
+        const bool changed_only = !is_archive && dirname == project_dir;
+        auto documents = create_documents(dirname, changed_only);
+        std::vector<std::future<void>> tasks;
+        for (auto& [document, filename] : documents)
+            tasks.push_back(std::async(std::launch::async, [document = document.get(),
+                                                            filename = filename]() {
+                document->save(filename);
+            }));
+        wait_all(tasks);
+
+        project_dir = dirname;
+        is_archive = false;
+        change_controller.resetChanged();
+        return true;
+    }
+
+    //! Loads all models from given directory. Files are parsed in parallel in worker threads,
+    //! models are populated afterwards in the calling thread. No model is changed if any of the
+    //! files can't be read.
+    bool load(const std::string& dirname)
+    {
+        if (!Utils::is_directory(dirname))
+            return false;
+
+        auto documents = create_documents(dirname);
+        std::vector<std::future<std::function<void()>>> tasks;
+        for (auto& [document, filename] : documents)
+            tasks.push_back(std::async(std::launch::async, [document = document.get(),
+                                                            filename = filename]() {
+                return document->prepare_load(filename);
+            }));
+        auto populate_callbacks = wait_all(tasks);
+
+        for (auto& populate : populate_callbacks)
+            populate();
+
+        project_dir = dirname;
+        is_archive = false;
+        change_controller.resetChanged();
+        return true;
+    }
+
+    //! Saves all models into a single archive file. Models are serialized and compressed in
+    //! parallel worker threads. When saving into the current archive, compressed content of
+    //! unchanged models is copied from the existing archive without recompression.
+    bool save_archive(const std::string& file_name)
+    {
+        const auto parent_dir = Utils::parent_path(file_name);
+        if (!parent_dir.empty() && !Utils::exists(parent_dir))
+            return false;
+
+        ProjectArchive archive(file_name);
+        const auto reusable_names = is_archive && file_name == project_dir
+                                        ? unchanged_entries(archive)
+                                        : std::vector<std::string>();
+
+        std::vector<std::future<ProjectArchive::Entry>> tasks;
         for (auto model : models()) {
-            auto document = CreateJsonDocument({model});
-            auto filename = Utils::join(dirname, ProjectUtils::SuggestFileName(*model));
-            std::invoke(method, document, filename);
+            auto format = archive_format(*model);
+            auto name = ProjectUtils::SuggestFileName(*model, format);
+            auto reusable = std::find(reusable_names.begin(), reusable_names.end(), name)
+                            != reusable_names.end();
+            tasks.push_back(std::async(std::launch::async, [&archive, model, format, name,
+                                                            reusable]() {
+                if (reusable)
+                    return archive.readCompressed(name);
+                QBuffer buffer;
+                buffer.open(QIODevice::WriteOnly);
+                CreateModelDocument({model}, format)->save(buffer);
+                return ProjectArchive::compress(name, buffer.data());
+            }));
         }
-        project_dir = dirname;
+        archive.write(wait_all(tasks));
+
+        project_dir = file_name;
+        is_archive = true;
         change_controller.resetChanged();
         return true;
     }
+
+    //! Loads all models from the archive file. Entries are decompressed and parsed in parallel
+    //! in worker threads, models are populated afterwards in the calling thread. No model is
+    //! changed if any of the entries can't be read.
+    bool load_archive(const std::string& file_name)
+    {
+        if (!Utils::exists(file_name))
+            return false;
+
+        ProjectArchive archive(file_name);
+        std::vector<std::future<std::function<void()>>> tasks;
+        for (auto model : models()) {
+            auto format = archive_format(*model);
+            auto name = ProjectUtils::SuggestFileName(*model, format);
+            tasks.push_back(std::async(std::launch::async, [&archive, model, format, name]() {
+                auto data = archive.read(name);
+                QBuffer buffer(&data);
+                buffer.open(QIODevice::ReadOnly);
+                return CreateModelDocument({model}, format)->prepare_load(buffer);
+            }));
+        }
+        auto populate_callbacks = wait_all(tasks);
+
+        for (auto& populate : populate_callbacks)
+            populate();
+
+        project_dir = file_name;
+        is_archive = true;
+        change_controller.resetChanged();
+        return true;
+    }
+
+    //! Returns document format of the model inside the archive. Blobs are not supported there,
+    //! large arrays are stored inline and compressed together with the rest of the model.
+    DocumentFormat archive_format(const SessionModel& model) const
+    {
+        auto format = app_models->document_format(model);
+        return format == DocumentFormat::JSON_WITH_BLOBS ? DocumentFormat::JSON : format;
+    }
+
+    //! Returns names of entries in the existing archive, belonging to unchanged models.
+    //! The archive which can't be read is simply rewritten.
+    std::vector<std::string> unchanged_entries(const ProjectArchive& archive) const
+    {
+        if (!Utils::exists(archive.fileName()))
+            return {};
+
+        std::vector<std::string> archive_names;
+        try {
+            archive_names = archive.entryNames();
+        } catch (const std::runtime_error&) {
+            return {};
+        }
+
+        std::vector<std::string> result;
+        for (auto model : models()) {
+            auto name = ProjectUtils::SuggestFileName(*model, archive_format(*model));
+            if (!change_controller.hasChanged(model)
+                && std::find(archive_names.begin(), archive_names.end(), name)
+                       != archive_names.end())
+                result.push_back(name);
+        }
+        return result;
+    }
+
+    //! Creates a document for every model, together with the name of the file in given directory.
+    //! If `changed_only` is true, models which weren't changed and already have the file, are
+    //! skipped.
+    std::vector<std::pair<std::unique_ptr<ModelDocumentInterface>, std::string>>
+    create_documents(const std::string& dirname, bool changed_only = false) const
+    {
+        std::vector<std::pair<std::unique_ptr<ModelDocumentInterface>, std::string>> result;
+        for (auto model : models()) {
+            auto format = app_models->document_format(*model);
+            auto filename = Utils::join(dirname, ProjectUtils::SuggestFileName(*model, format));
+            if (changed_only && !change_controller.hasChanged(model) && Utils::exists(filename))
+                continue;
+            result.emplace_back(CreateModelDocument({model}, format), filename);
+        }
+        return result;
+    }
+
+    //! Waits for all tasks to complete and returns their results. The first exception thrown by
+    //! the tasks is rethrown only after all of them have finished.
+    template <typename T> static auto wait_all(std::vector<std::future<T>>& tasks)
+    {
+        for (auto& task : tasks)
+            task.wait();
+
+        if constexpr (std::is_void_v<T>) {
+            for (auto& task : tasks)
+                task.get();
+        } else {
+            std::vector<T> result;
+            for (auto& task : tasks)
+                result.push_back(task.get());
+            return result;
+        }
+    }
 };
 
 Project::Project(ApplicationModelsInterface* app_models, callback_t project_changed_callback)
@@ -65,16 +242,31 @@ std::string Project::projectDir() const
 
 bool Project::save(const std::string& dirname) const
 {
-    return p_impl->process(dirname, &ModelDocumentInterface::save);
+    return p_impl->save(dirname);
 }
 
 //! Loads all models from the given directory.
 bool Project::load(const std::string& dirname)
 {
-    return p_impl->process(dirname, &ModelDocumentInterface::load);
+    return p_impl->load(dirname);
 }
 
 bool Project::isModified() const
 {
     return p_impl->change_controller.hasChanged();
 }
+
+//! Saves all models into a single compressed archive file. Parent directory should exist.
+//! Provided name will become 'projectDir'.
+
+bool Project::saveArchive(const std::string& file_name) const
+{
+    return p_impl->save_archive(file_name);
+}
+
+//! Loads all models from the archive file.
+
+bool Project::loadArchive(const std::string& file_name)
+{
+    return p_impl->load_archive(file_name);
+}
@@ -20,7 +20,8 @@ namespace ModelView
 class ApplicationModelsInterface;
 
 //! Project represents content of all application models in a folder on disk.
-//! Responsible for saving/loading application models to/from disk.
+//! Responsible for saving/loading application models to/from disk. Models can be also kept
+//! in a single compressed archive file.
 
 class MVVM_MODEL_EXPORT Project : public ModelView::ProjectInterface
 {
@@ -38,6 +39,10 @@ public:
 
     bool isModified() const override;
 
+    bool saveArchive(const std::string& file_name) const;
+
+    bool loadArchive(const std::string& file_name);
+
 private:
     struct ProjectImpl;
     std::unique_ptr<ProjectImpl> p_impl;
@@ -0,0 +1,218 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+#include <algorithm>
+#include <mvvm/project/projectarchive.h>
+#include <mvvm/serialization/binaryutils.h>
+#include <set>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace
+{
+const quint32 archive_magic = 0x4D565041; // "MVPA"
+const quint32 archive_version = 1;
+const qint64 header_size = 8;  // magic and version
+const qint64 trailer_size = 12; // index offset and magic
+
+//! Index record describing the position of a single entry in the archive.
+struct IndexRecord {
+    std::string name;
+    quint64 offset{0};
+    quint64 compressed_size{0};
+    quint64 size{0};
+};
+
+} // namespace
+
+struct ProjectArchive::ProjectArchiveImpl {
+    std::string file_name;
+
+    ProjectArchiveImpl(std::string file_name) : file_name(std::move(file_name)) {}
+
+    void open(QFile& file) const
+    {
+        file.setFileName(QString::fromStdString(file_name));
+        if (!file.open(QIODevice::ReadOnly))
+            throw std::runtime_error("ProjectArchive::read() -> Error. Can't read the file '"
+                                     + file_name + "'");
+    }
+
+    [[noreturn]] void throw_corrupted() const
+    {
+        throw std::runtime_error("ProjectArchive::read() -> Error. File '" + file_name
+                                 + "' is not a valid archive");
+    }
+
+    //! Reads the index located at the end of the archive. Only the index is read.
+    std::vector<IndexRecord> read_index(QFile& file) const
+    {
+        if (file.size() < header_size + trailer_size)
+            throw_corrupted();
+
+        QDataStream stream(&file);
+        BinaryUtils::SetupStream(stream);
+
+        quint32 magic{0}, version{0};
+        stream >> magic >> version;
+        if (magic != archive_magic || version != archive_version)
+            throw_corrupted();
+
+        const quint64 index_end = static_cast<quint64>(file.size() - trailer_size);
+        quint64 index_offset{0};
+        file.seek(static_cast<qint64>(index_end));
+        stream >> index_offset >> magic;
+        if (magic != archive_magic || index_offset < header_size || index_offset > index_end)
+            throw_corrupted();
+
+        file.seek(static_cast<qint64>(index_offset));
+        quint32 count{0};
+        stream >> count;
+
+        std::vector<IndexRecord> result;
+        for (quint32 i = 0; i < count; ++i) {
+            QByteArray name;
+            IndexRecord record;
+            stream >> name >> record.offset >> record.compressed_size >> record.size;
+            BinaryUtils::CheckStatus(stream, "ProjectArchive::read()");
+            if (record.offset < header_size || record.compressed_size > index_offset
+                || record.offset > index_offset - record.compressed_size)
+                throw_corrupted();
+            record.name = name.toStdString();
+            result.push_back(record);
+        }
+        BinaryUtils::CheckStatus(stream, "ProjectArchive::read()");
+
+        return result;
+    }
+
+    //! Returns the index record and the compressed content of the entry with given name.
+    std::pair<IndexRecord, QByteArray> read_entry(const std::string& name) const
+    {
+        QFile file;
+        open(file);
+        auto index = read_index(file);
+
+        auto it = std::find_if(index.begin(), index.end(),
+                               [&name](const auto& record) { return record.name == name; });
+        if (it == index.end())
+            throw std::runtime_error("ProjectArchive::read() -> Error. No entry '" + name
+                                     + "' in the file '" + file_name + "'");
+
+        file.seek(static_cast<qint64>(it->offset));
+        auto data = file.read(static_cast<qint64>(it->compressed_size));
+        if (static_cast<quint64>(data.size()) != it->compressed_size)
+            throw_corrupted();
+
+        return {*it, data};
+    }
+};
+
+ProjectArchive::ProjectArchive(const std::string& file_name)
+    : p_impl(std::make_unique<ProjectArchiveImpl>(file_name))
+{
+}
+
+ProjectArchive::~ProjectArchive() = default;
+
+std::string ProjectArchive::fileName() const
+{
+    return p_impl->file_name;
+}
+
+//! Compresses given data and returns an entry ready to be written in the archive.
+//! Compression doesn't depend on the archive, so entries can be prepared in parallel.
+
+ProjectArchive::Entry ProjectArchive::compress(const std::string& name, const QByteArray& data)
+{
+    return {name, qCompress(data), static_cast<quint64>(data.size())};
+}
+
+//! Writes entries into the archive, replacing its previous content. The file consists of
+//! the header, compressed entries one after another, the index and the trailer pointing to it.
+//! Content goes to a temporary file first, which then atomically replaces the target.
+
+void ProjectArchive::write(const std::vector<Entry>& entries) const
+{
+    std::set<std::string> names;
+    for (const auto& entry : entries)
+        if (!names.insert(entry.name).second)
+            throw std::runtime_error("ProjectArchive::write() -> Error. Duplicated entry '"
+                                     + entry.name + "'");
+
+    QSaveFile file(QString::fromStdString(p_impl->file_name));
+    if (!file.open(QIODevice::WriteOnly))
+        throw std::runtime_error("ProjectArchive::write() -> Error. Can't save the file '"
+                                 + p_impl->file_name + "'");
+
+    QDataStream stream(&file);
+    BinaryUtils::SetupStream(stream);
+    stream << archive_magic << archive_version;
+
+    std::vector<quint64> offsets;
+    for (const auto& entry : entries) {
+        offsets.push_back(static_cast<quint64>(file.pos()));
+        stream.writeRawData(entry.compressed_data.constData(), entry.compressed_data.size());
+    }
+
+    const auto index_offset = static_cast<quint64>(file.pos());
+    stream << static_cast<quint32>(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i)
+        stream << QByteArray::fromStdString(entries[i].name) << offsets[i]
+               << static_cast<quint64>(entries[i].compressed_data.size()) << entries[i].size;
+    stream << index_offset << archive_magic;
+
+    BinaryUtils::CheckStatus(stream, "ProjectArchive::write()");
+    if (!file.commit())
+        throw std::runtime_error("ProjectArchive::write() -> Error. Can't save the file '"
+                                 + p_impl->file_name + "'");
+}
+
+//! Returns names of all entries in the archive. Only the index is read.
+
+std::vector<std::string> ProjectArchive::entryNames() const
+{
+    QFile file;
+    p_impl->open(file);
+    std::vector<std::string> result;
+    for (const auto& record : p_impl->read_index(file))
+        result.push_back(record.name);
+    return result;
+}
+
+bool ProjectArchive::hasEntry(const std::string& name) const
+{
+    auto names = entryNames();
+    return std::find(names.begin(), names.end(), name) != names.end();
+}
+
+//! Reads and decompresses a single entry. Other entries are neither read, nor decompressed.
+//! Method can be called from several threads at once, each call uses its own file handle.
+
+QByteArray ProjectArchive::read(const std::string& name) const
+{
+    auto [record, compressed_data] = p_impl->read_entry(name);
+    auto result = qUncompress(compressed_data);
+    if (static_cast<quint64>(result.size()) != record.size)
+        throw std::runtime_error("ProjectArchive::read() -> Error. Entry '" + name
+                                 + "' is corrupted");
+    return result;
+}
+
+//! Reads a single entry without decompressing it.
+
+ProjectArchive::Entry ProjectArchive::readCompressed(const std::string& name) const
+{
+    auto [record, compressed_data] = p_impl->read_entry(name);
+    return {record.name, compressed_data, record.size};
+}
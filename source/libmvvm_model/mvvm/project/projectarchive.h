@@ -0,0 +1,64 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_PROJECT_PROJECTARCHIVE_H
+#define MVVM_PROJECT_PROJECTARCHIVE_H
+
+#include <QByteArray>
+#include <memory>
+#include <mvvm/model_export.h>
+#include <string>
+#include <vector>
+
+namespace ModelView
+{
+
+/*!
+@class ProjectArchive
+@brief Single file containing compressed content of all project models.
+
+Each entry is compressed separately. Entries are followed by the index with their names and
+positions, so a single entry can be read without decompressing the rest of the archive.
+*/
+
+class MVVM_MODEL_EXPORT ProjectArchive
+{
+public:
+    //! Compressed content of a single archive entry.
+    struct Entry {
+        std::string name;
+        QByteArray compressed_data;
+        quint64 size{0}; //!< size of uncompressed data
+    };
+
+    explicit ProjectArchive(const std::string& file_name);
+    ~ProjectArchive();
+
+    std::string fileName() const;
+
+    static Entry compress(const std::string& name, const QByteArray& data);
+
+    void write(const std::vector<Entry>& entries) const;
+
+    std::vector<std::string> entryNames() const;
+
+    bool hasEntry(const std::string& name) const;
+
+    QByteArray read(const std::string& name) const;
+
+    Entry readCompressed(const std::string& name) const;
+
+private:
+    struct ProjectArchiveImpl;
+    std::unique_ptr<ProjectArchiveImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_PROJECT_PROJECTARCHIVE_H
@@ -36,6 +36,14 @@ struct ProjectChangedController::ProjectChangedControllerImpl {
 
     bool hasChanged() const { return m_project_has_changed; }
 
+    bool hasChanged(const SessionModel* model) const
+    {
+        for (size_t i = 0; i < m_models.size(); ++i)
+            if (m_models[i] == model)
+                return change_controllers[i]->hasChanged();
+        return true;
+    }
+
     void resetChanged()
     {
         for (auto& controller : change_controllers)
@@ -69,6 +77,15 @@ bool ProjectChangedController::hasChanged() const
     return p_impl->hasChanged();
 }
 
+//! Returns true if given model has been changed since the last call of resetChanged.
+//! Models unknown to the controller are always reported as changed, since their changes are not
+//! tracked.
+
+bool ProjectChangedController::hasChanged(const SessionModel* model) const
+{
+    return p_impl->hasChanged(model);
+}
+
 //! Reset controller to initial state, pretending that no changes has been registered.
 
 void ProjectChangedController::resetChanged()
@@ -39,6 +39,8 @@ public:
 
     bool hasChanged() const;
 
+    bool hasChanged(const SessionModel* model) const;
+
     void resetChanged();
 
 private:
@@ -19,25 +19,27 @@ using namespace ModelView;
 namespace
 {
 const std::string json_extention = ".json";
+const std::string binary_extention = ".mvb";
 const std::string untitled_name = "Untitled";
 } // namespace
 
-//! Suggests file name which can be used to store json content of given model.
+//! Suggests file name which can be used to store content of given model in given format.
 //! Uses the model type to construct a filename: MaterialModel -> materialmodel.json
 
-std::string ProjectUtils::SuggestFileName(const SessionModel& model)
+std::string ProjectUtils::SuggestFileName(const SessionModel& model, DocumentFormat format)
 {
     std::string result = model.modelType();
     std::transform(result.begin(), result.end(), result.begin(), ::tolower);
-    return result + json_extention;
+    return result + (format == DocumentFormat::BINARY ? binary_extention : json_extention);
 }
 
 //! Returns 'true' if given directory might be a project directory.
-//! This simplified check counts number of files with json extention.
+//! This simplified check counts number of files with json or binary model extention.
 
 bool ProjectUtils::IsPossibleProjectDir(const std::string& project_dir)
 {
-    return !Utils::FindFiles(project_dir, json_extention).empty();
+    return !Utils::FindFiles(project_dir, json_extention).empty()
+           || !Utils::FindFiles(project_dir, binary_extention).empty();
 }
 
 //! Creates new untitled project.
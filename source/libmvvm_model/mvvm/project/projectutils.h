@@ -12,6 +12,7 @@
 
 #include <functional>
 #include <memory>
+#include <mvvm/interfaces/modeldocumentinterface.h>
 #include <mvvm/model_export.h>
 #include <string>
 #include <vector>
@@ -28,7 +29,8 @@ class ProjectInterface;
 namespace ProjectUtils
 {
 
-MVVM_MODEL_EXPORT std::string SuggestFileName(const SessionModel& model);
+MVVM_MODEL_EXPORT std::string SuggestFileName(const SessionModel& model,
+                                              DocumentFormat format = DocumentFormat::JSON);
 
 MVVM_MODEL_EXPORT bool IsPossibleProjectDir(const std::string& project_dir);
 
@@ -0,0 +1,78 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYCONVERTERINTERFACES_H
+#define MVVM_SERIALIZATION_BINARYCONVERTERINTERFACES_H
+
+#include <memory>
+#include <mvvm/model_export.h>
+
+class QDataStream;
+class QVariant;
+
+namespace ModelView
+{
+
+class BinaryStringTable;
+class SessionModel;
+class SessionItem;
+class TagInfo;
+
+//! Base class for all converters of QVariant to/from binary stream.
+//! Strings are written through the string table, which is filled both on writing and reading.
+
+class MVVM_MODEL_EXPORT BinaryVariantInterface
+{
+public:
+    virtual ~BinaryVariantInterface() = default;
+
+    virtual void to_stream(const QVariant&, QDataStream&, BinaryStringTable&) = 0;
+
+    virtual QVariant from_stream(QDataStream&, BinaryStringTable&) = 0;
+};
+
+//! Base class for all converters of TagInfo to/from binary stream.
+
+class MVVM_MODEL_EXPORT BinaryTagInfoInterface
+{
+public:
+    virtual ~BinaryTagInfoInterface() = default;
+
+    virtual void to_stream(const TagInfo&, QDataStream&, BinaryStringTable&) = 0;
+
+    virtual TagInfo from_stream(QDataStream&, BinaryStringTable&) = 0;
+};
+
+//! Base class for all converters of SessionItem to/from binary stream.
+
+class MVVM_MODEL_EXPORT BinaryItemConverterInterface
+{
+public:
+    virtual ~BinaryItemConverterInterface() = default;
+
+    virtual void to_stream(const SessionItem& item, QDataStream&, BinaryStringTable&) const = 0;
+
+    virtual std::unique_ptr<SessionItem> from_stream(QDataStream&, BinaryStringTable&) const = 0;
+};
+
+//! Base class for all converters of SessionModel to/from binary stream.
+
+class MVVM_MODEL_EXPORT BinaryModelConverterInterface
+{
+public:
+    virtual ~BinaryModelConverterInterface() = default;
+
+    virtual void model_to_stream(const SessionModel&, QDataStream&) const = 0;
+
+    virtual void stream_to_model(QDataStream&, SessionModel&) const = 0;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYCONVERTERINTERFACES_H
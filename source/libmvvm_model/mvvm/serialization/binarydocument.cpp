@@ -0,0 +1,128 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+#include <mvvm/model/modelutils.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/serialization/binarydocument.h>
+#include <mvvm/serialization/binarymodelconverter.h>
+#include <mvvm/serialization/binaryutils.h>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ModelView;
+
+struct BinaryDocument::BinaryDocumentImpl {
+    std::vector<SessionModel*> models;
+    BinaryDocumentImpl(const std::initializer_list<ModelView::SessionModel*>& models)
+        : models(models)
+    {
+    }
+
+    //! Writes number of models, followed by binary models.
+    void write(QIODevice& device) const
+    {
+        QDataStream stream(&device);
+        BinaryUtils::SetupStream(stream);
+
+        BinaryModelConverter converter;
+        stream << static_cast<quint32>(models.size());
+        for (auto model : models)
+            converter.model_to_stream(*model, stream);
+    }
+
+    //! Reads all models from the device and returns the function to populate them.
+    std::function<void()> read(QIODevice& device) const
+    {
+        QDataStream stream(&device);
+        BinaryUtils::SetupStream(stream);
+
+        quint32 count{0};
+        stream >> count;
+        BinaryUtils::CheckStatus(stream, "BinaryDocument::load()");
+        if (count != models.size()) {
+            std::ostringstream ostr;
+            ostr << "Error in BinaryDocument: number of application models " << models.size()
+                 << " and number of binary models " << count << " doesn't match";
+            throw std::runtime_error(ostr.str());
+        }
+
+        BinaryModelConverter converter;
+        auto items = std::make_shared<std::vector<std::vector<std::unique_ptr<SessionItem>>>>();
+        for (auto model : models)
+            items->push_back(converter.stream_to_items(stream, *model));
+
+        return [models = models, items]() {
+            for (size_t i = 0; i < models.size(); ++i)
+                Utils::PopulateModel(models[i], std::move(items->at(i)));
+        };
+    }
+};
+
+BinaryDocument::BinaryDocument(std::initializer_list<ModelView::SessionModel*> models)
+    : p_impl(std::make_unique<BinaryDocumentImpl>(models))
+{
+}
+
+//! Saves models on disk. File contains number of models, followed by binary models.
+//! Content goes to a temporary file first, which then atomically replaces the target.
+
+void BinaryDocument::save(const std::string& file_name) const
+{
+    QSaveFile file(QString::fromStdString(file_name));
+    if (!file.open(QIODevice::WriteOnly))
+        throw std::runtime_error("Error in BinaryDocument: can't save the file '" + file_name
+                                 + "'");
+
+    p_impl->write(file);
+
+    if (!file.commit())
+        throw std::runtime_error("Error in BinaryDocument: can't save the file '" + file_name
+                                 + "'");
+}
+
+//! Loads models from disk. If models have some data already, it will be rewritten.
+
+void BinaryDocument::load(const std::string& file_name)
+{
+    prepare_load(file_name)();
+}
+
+//! Reads all models from disk and returns the function to populate them. Models are not
+//! modified if the file can't be read.
+
+std::function<void()> BinaryDocument::prepare_load(const std::string& file_name)
+{
+    QFile file(QString::fromStdString(file_name));
+    if (!file.open(QIODevice::ReadOnly))
+        throw std::runtime_error("Error in BinaryDocument: can't read the file '" + file_name
+                                 + "'");
+
+    return p_impl->read(file);
+}
+
+//! Writes models into the device.
+
+void BinaryDocument::save(QIODevice& device) const
+{
+    p_impl->write(device);
+}
+
+//! Reads models from the device and returns the function to populate them.
+
+std::function<void()> BinaryDocument::prepare_load(QIODevice& device)
+{
+    return p_impl->read(device);
+}
+
+BinaryDocument::~BinaryDocument() = default;
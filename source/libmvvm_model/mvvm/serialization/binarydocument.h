@@ -0,0 +1,47 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYDOCUMENT_H
+#define MVVM_SERIALIZATION_BINARYDOCUMENT_H
+
+#include <initializer_list>
+#include <memory>
+#include <mvvm/interfaces/modeldocumentinterface.h>
+
+namespace ModelView
+{
+
+class SessionModel;
+
+/*!
+@class BinaryDocument
+@brief Saves and restores list of SessionModel's to/from disk using compact binary format.
+*/
+
+class MVVM_MODEL_EXPORT BinaryDocument : public ModelDocumentInterface
+{
+public:
+    BinaryDocument(std::initializer_list<SessionModel*> models);
+    ~BinaryDocument() override;
+
+    void save(const std::string& file_name) const override;
+    void load(const std::string& file_name) override;
+    std::function<void()> prepare_load(const std::string& file_name) override;
+
+    void save(QIODevice& device) const override;
+    std::function<void()> prepare_load(QIODevice& device) override;
+
+private:
+    struct BinaryDocumentImpl;
+    std::unique_ptr<BinaryDocumentImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYDOCUMENT_H
@@ -0,0 +1,141 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QDataStream>
+#include <QVariant>
+#include <mvvm/core/uniqueidgenerator.h>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/itemfactoryinterface.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionitemcontainer.h>
+#include <mvvm/model/sessionitemdata.h>
+#include <mvvm/model/sessionitemtags.h>
+#include <mvvm/serialization/binaryitemconverter.h>
+#include <mvvm/serialization/binarystringtable.h>
+#include <mvvm/serialization/binarytaginfo.h>
+#include <mvvm/serialization/binaryutils.h>
+#include <mvvm/serialization/binaryvariant.h>
+#include <iterator>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Constructor of item/binary converter.
+//! @param factory: SessionItem factory.
+//! @param new_id_flag: generates exact item clones if false, generates new item's unique
+//! identifiers if true.
+
+BinaryItemConverter::BinaryItemConverter(const ItemFactoryInterface* factory, bool new_id_flag)
+    : m_variant_converter(std::make_unique<BinaryVariant>()),
+      m_taginfo_converter(std::make_unique<BinaryTagInfo>()), m_factory(factory),
+      m_generate_new_identifiers(new_id_flag)
+{
+}
+
+BinaryItemConverter::~BinaryItemConverter() = default;
+
+void BinaryItemConverter::to_stream(const SessionItem& item, QDataStream& stream,
+                                    BinaryStringTable& table) const
+{
+    table.write(item.modelType(), stream);
+
+    const auto& data = *item.itemData();
+    stream << static_cast<quint32>(std::distance(data.begin(), data.end()));
+    for (const auto& x : data) {
+        stream << static_cast<qint32>(x.m_role);
+        m_variant_converter->to_stream(Utils::ResolvedVariant(x.m_data), stream, table);
+    }
+
+    tags_to_stream(*item.itemTags(), stream, table);
+}
+
+std::unique_ptr<SessionItem> BinaryItemConverter::from_stream(QDataStream& stream,
+                                                              BinaryStringTable& table) const
+{
+    return stream_to_item(stream, table);
+}
+
+// --- to stream --------------------------------------------------------------
+
+void BinaryItemConverter::tags_to_stream(const SessionItemTags& tags, QDataStream& stream,
+                                         BinaryStringTable& table) const
+{
+    table.write(tags.defaultTag(), stream);
+    stream << static_cast<quint32>(std::distance(tags.begin(), tags.end()));
+
+    for (auto container : tags) {
+        m_taginfo_converter->to_stream(container->tagInfo(), stream, table);
+        stream << static_cast<quint32>(container->itemCount());
+        for (auto item : *container)
+            to_stream(*item, stream, table);
+    }
+}
+
+// --- from stream ------------------------------------------------------------
+
+std::unique_ptr<SessionItem> BinaryItemConverter::stream_to_item(QDataStream& stream,
+                                                                 BinaryStringTable& table,
+                                                                 SessionItem* parent) const
+{
+    const auto model_type = table.read(stream);
+    quint32 data_count{0};
+    stream >> data_count;
+    BinaryUtils::CheckStatus(stream, "BinaryItemConverter::from_stream()");
+
+    auto result = m_factory->createItem(model_type);
+    result->setParent(parent);
+
+    auto data = std::make_unique<SessionItemData>();
+    for (quint32 i = 0; i < data_count; ++i) {
+        qint32 role{0};
+        stream >> role;
+        auto variant = m_variant_converter->from_stream(stream, table);
+        if (role == ItemDataRole::IDENTIFIER)
+            variant = Utils::IdentifierVariant(variant);
+        data->setData(variant, role);
+    }
+
+    result->setDataAndTags(std::move(data), stream_to_tags(stream, table, result.get()));
+
+    if (m_generate_new_identifiers)
+        result->setData(UniqueIdGenerator::generate(), ItemDataRole::IDENTIFIER);
+
+    return result;
+}
+
+std::unique_ptr<SessionItemTags> BinaryItemConverter::stream_to_tags(QDataStream& stream,
+                                                                     BinaryStringTable& table,
+                                                                     SessionItem* parent) const
+{
+    const auto default_tag = table.read(stream);
+    quint32 container_count{0};
+    stream >> container_count;
+    BinaryUtils::CheckStatus(stream, "BinaryItemConverter::from_stream()");
+
+    auto result = std::make_unique<SessionItemTags>();
+    result->setDefaultTag(default_tag);
+
+    for (quint32 i = 0; i < container_count; ++i) {
+        TagInfo tagInfo = m_taginfo_converter->from_stream(stream, table);
+        result->registerTag(tagInfo);
+
+        quint32 item_count{0};
+        stream >> item_count;
+        BinaryUtils::CheckStatus(stream, "BinaryItemConverter::from_stream()");
+        for (quint32 row = 0; row < item_count; ++row) {
+            auto item = stream_to_item(stream, table, parent);
+            if (!result->insertItem(item.get(), TagRow::append(tagInfo.name())))
+                throw std::runtime_error(
+                    "BinaryItemConverter::from_stream() -> Error. Can't insert item.");
+            item.release();
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,54 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYITEMCONVERTER_H
+#define MVVM_SERIALIZATION_BINARYITEMCONVERTER_H
+
+#include <mvvm/serialization/binaryconverterinterfaces.h>
+
+namespace ModelView
+{
+
+class SessionItemTags;
+class ItemFactoryInterface;
+
+//! Default converter between SessionItem and binary stream.
+//! Item is written as model type, list of role/variant pairs and containers with children.
+//! All counts are written in front of the elements they refer to.
+
+class MVVM_MODEL_EXPORT BinaryItemConverter : public BinaryItemConverterInterface
+{
+public:
+    BinaryItemConverter(const ItemFactoryInterface* factory, bool new_id_flag = false);
+    ~BinaryItemConverter() override;
+
+    void to_stream(const SessionItem& item, QDataStream& stream,
+                   BinaryStringTable& table) const override;
+
+    std::unique_ptr<SessionItem> from_stream(QDataStream& stream,
+                                             BinaryStringTable& table) const override;
+
+private:
+    void tags_to_stream(const SessionItemTags& tags, QDataStream& stream,
+                        BinaryStringTable& table) const;
+
+    std::unique_ptr<SessionItem> stream_to_item(QDataStream& stream, BinaryStringTable& table,
+                                                SessionItem* parent = nullptr) const;
+    std::unique_ptr<SessionItemTags> stream_to_tags(QDataStream& stream, BinaryStringTable& table,
+                                                    SessionItem* parent) const;
+
+    std::unique_ptr<BinaryVariantInterface> m_variant_converter;
+    std::unique_ptr<BinaryTagInfoInterface> m_taginfo_converter;
+    const ItemFactoryInterface* m_factory;
+    bool m_generate_new_identifiers;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYITEMCONVERTER_H
@@ -0,0 +1,102 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QByteArray>
+#include <QDataStream>
+#include <mvvm/model/modelutils.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/serialization/binaryitemconverter.h>
+#include <mvvm/serialization/binarymodelconverter.h>
+#include <mvvm/serialization/binarystringtable.h>
+#include <mvvm/serialization/binaryutils.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+const quint32 BinaryModelConverter::magicNumber = 0x42564d4d; // "MMVB"
+const quint16 BinaryModelConverter::formatVersion = 2;
+
+BinaryModelConverter::BinaryModelConverter() = default;
+
+BinaryModelConverter::~BinaryModelConverter() = default;
+
+//! Writes the model straight into the stream, item by item. Strings are written at their first
+//! occurrence, so no intermediate buffer is needed.
+
+void BinaryModelConverter::model_to_stream(const SessionModel& model, QDataStream& stream) const
+{
+    if (!model.rootItem())
+        throw std::runtime_error(
+            "BinaryModelConverter::model_to_stream() -> Error. Model is not initialized.");
+
+    const auto& model_type = model.modelType();
+    stream << magicNumber << formatVersion;
+    stream << QByteArray::fromRawData(model_type.data(), static_cast<int>(model_type.size()));
+
+    BinaryStringTable table;
+    BinaryItemConverter converter(model.factory());
+    auto children = model.rootItem()->children();
+    stream << static_cast<quint32>(children.size());
+    for (auto item : children)
+        converter.to_stream(*item, stream, table);
+
+    BinaryUtils::CheckStatus(stream, "BinaryModelConverter::model_to_stream()");
+}
+
+void BinaryModelConverter::stream_to_model(QDataStream& stream, SessionModel& model) const
+{
+    if (!model.rootItem())
+        throw std::runtime_error(
+            "BinaryModelConverter::stream_to_model() -> Error. Model is not initialized.");
+
+    Utils::PopulateModel(&model, stream_to_items(stream, model));
+}
+
+//! Reads top level items from the stream. Only constant methods of the model are used, so
+//! reading can be done in a worker thread.
+
+std::vector<std::unique_ptr<SessionItem>>
+BinaryModelConverter::stream_to_items(QDataStream& stream, const SessionModel& model) const
+{
+    quint32 magic{0};
+    quint16 version{0};
+    stream >> magic >> version;
+    BinaryUtils::CheckStatus(stream, "BinaryModelConverter::stream_to_items()");
+
+    if (magic != magicNumber)
+        throw std::runtime_error(
+            "BinaryModelConverter::stream_to_items() -> Error. Not a binary model.");
+
+    if (version != formatVersion)
+        throw std::runtime_error(
+            "BinaryModelConverter::stream_to_items() -> Error. Unsupported format version "
+            + std::to_string(version) + ".");
+
+    QByteArray model_type;
+    stream >> model_type;
+    BinaryUtils::CheckStatus(stream, "BinaryModelConverter::stream_to_items()");
+
+    if (model_type.toStdString() != model.modelType())
+        throw std::runtime_error(
+            "BinaryModelConverter::stream_to_items() -> Unexpected model type '"
+            + model.modelType() + "', binary data '" + model_type.toStdString() + "'");
+
+    quint32 count{0};
+    stream >> count;
+    BinaryUtils::CheckStatus(stream, "BinaryModelConverter::stream_to_items()");
+
+    BinaryStringTable table;
+    BinaryItemConverter converter(model.factory());
+    std::vector<std::unique_ptr<SessionItem>> result;
+    for (quint32 i = 0; i < count; ++i)
+        result.push_back(converter.from_stream(stream, table));
+
+    return result;
+}
@@ -0,0 +1,60 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYMODELCONVERTER_H
+#define MVVM_SERIALIZATION_BINARYMODELCONVERTER_H
+
+#include <QtGlobal>
+#include <memory>
+#include <mvvm/serialization/binaryconverterinterfaces.h>
+#include <vector>
+
+namespace ModelView
+{
+
+class SessionItem;
+
+/*!
+@class BinaryModelConverter
+@brief Converts SessionModel to/from compact binary stream.
+
+Layout (all integers are little-endian):
+- magic number and format version;
+- model type as length-prefixed UTF-8 string;
+- number of top level items, followed by the items.
+
+Model types, tag names, identifiers and other strings are kept in the string table: the first
+occurrence of the string is written as a new table index followed by the length-prefixed string,
+later occurrences as the index only. The model is written and read in a single pass without
+intermediate buffers.
+*/
+
+class MVVM_MODEL_EXPORT BinaryModelConverter : public BinaryModelConverterInterface
+{
+public:
+    static const quint32 magicNumber;
+    static const quint16 formatVersion;
+
+    BinaryModelConverter();
+    ~BinaryModelConverter() override;
+
+    //! Writes content of model into binary stream.
+    void model_to_stream(const SessionModel& model, QDataStream& stream) const override;
+
+    //! Reads binary stream and build the model.
+    void stream_to_model(QDataStream& stream, SessionModel& model) const override;
+
+    //! Reads top level items of the model from binary stream, the model itself is not changed.
+    std::vector<std::unique_ptr<SessionItem>> stream_to_items(QDataStream& stream,
+                                                              const SessionModel& model) const;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYMODELCONVERTER_H
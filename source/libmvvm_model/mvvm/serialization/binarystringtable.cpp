@@ -0,0 +1,76 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QByteArray>
+#include <QDataStream>
+#include <mvvm/serialization/binarystringtable.h>
+#include <mvvm/serialization/binaryutils.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Returns index of given string in the table. String is added to the table if necessary.
+
+quint32 BinaryStringTable::index(const std::string& str)
+{
+    auto it = m_indices.find(str);
+    if (it != m_indices.end())
+        return it->second;
+
+    auto result = static_cast<quint32>(m_strings.size());
+    m_strings.push_back(str);
+    m_indices.emplace(str, result);
+    return result;
+}
+
+//! Returns string with given index.
+
+const std::string& BinaryStringTable::string(quint32 index) const
+{
+    if (index >= m_strings.size())
+        throw std::runtime_error("BinaryStringTable::string() -> Error. Index "
+                                 + std::to_string(index) + " is out of range.");
+    return m_strings[index];
+}
+
+std::size_t BinaryStringTable::size() const
+{
+    return m_strings.size();
+}
+
+//! Writes the string into the stream as its index in the table. At the first occurrence the index
+//! is followed by the length-prefixed UTF-8 string itself.
+
+void BinaryStringTable::write(const std::string& str, QDataStream& stream)
+{
+    const auto new_index = static_cast<quint32>(m_strings.size());
+    const auto result = index(str);
+    stream << result;
+    if (result == new_index)
+        stream << QByteArray::fromRawData(str.data(), static_cast<int>(str.size()));
+}
+
+//! Reads the string written by write(). Strings met for the first time are added to the table.
+
+std::string BinaryStringTable::read(QDataStream& stream)
+{
+    quint32 result{0};
+    stream >> result;
+    BinaryUtils::CheckStatus(stream, "BinaryStringTable::read()");
+
+    if (result == m_strings.size()) {
+        QByteArray bytes;
+        stream >> bytes;
+        BinaryUtils::CheckStatus(stream, "BinaryStringTable::read()");
+        m_strings.emplace_back(bytes.constData(), static_cast<std::size_t>(bytes.size()));
+        m_indices.emplace(m_strings.back(), result);
+    }
+
+    return string(result);
+}
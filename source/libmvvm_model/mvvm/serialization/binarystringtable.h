@@ -0,0 +1,48 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYSTRINGTABLE_H
+#define MVVM_SERIALIZATION_BINARYSTRINGTABLE_H
+
+#include <QtGlobal>
+#include <mvvm/model_export.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class QDataStream;
+
+namespace ModelView
+{
+
+//! Table of unique strings used in binary serialization. Model types, tag names, identifiers
+//! and other strings are written only once, the content refers to them by index. The table is
+//! built while the content is written and read, so no separate pass is needed.
+
+class MVVM_MODEL_EXPORT BinaryStringTable
+{
+public:
+    quint32 index(const std::string& str);
+
+    const std::string& string(quint32 index) const;
+
+    std::size_t size() const;
+
+    void write(const std::string& str, QDataStream& stream);
+
+    std::string read(QDataStream& stream);
+
+private:
+    std::vector<std::string> m_strings;
+    std::unordered_map<std::string, quint32> m_indices;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYSTRINGTABLE_H
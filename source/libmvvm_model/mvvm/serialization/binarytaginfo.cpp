@@ -0,0 +1,45 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QDataStream>
+#include <mvvm/model/taginfo.h>
+#include <mvvm/serialization/binarystringtable.h>
+#include <mvvm/serialization/binarytaginfo.h>
+#include <mvvm/serialization/binaryutils.h>
+
+using namespace ModelView;
+
+//! Writes tag name, min, max and the list of allowed model types.
+
+void BinaryTagInfo::to_stream(const TagInfo& tag, QDataStream& stream, BinaryStringTable& table)
+{
+    table.write(tag.name(), stream);
+    stream << static_cast<qint32>(tag.min()) << static_cast<qint32>(tag.max());
+
+    auto model_types = tag.modelTypes();
+    stream << static_cast<quint32>(model_types.size());
+    for (const auto& model_type : model_types)
+        table.write(model_type, stream);
+}
+
+TagInfo BinaryTagInfo::from_stream(QDataStream& stream, BinaryStringTable& table)
+{
+    const auto name = table.read(stream);
+    qint32 min{0};
+    qint32 max{0};
+    quint32 count{0};
+    stream >> min >> max >> count;
+    BinaryUtils::CheckStatus(stream, "BinaryTagInfo::from_stream()");
+
+    std::vector<std::string> model_types;
+    for (quint32 i = 0; i < count; ++i)
+        model_types.push_back(table.read(stream));
+
+    return TagInfo(name, min, max, model_types);
+}
@@ -0,0 +1,30 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYTAGINFO_H
+#define MVVM_SERIALIZATION_BINARYTAGINFO_H
+
+#include <mvvm/serialization/binaryconverterinterfaces.h>
+
+namespace ModelView
+{
+
+//! Default converter between TagInfo and binary stream.
+
+class MVVM_MODEL_EXPORT BinaryTagInfo : public BinaryTagInfoInterface
+{
+public:
+    void to_stream(const TagInfo& tag, QDataStream& stream, BinaryStringTable& table) override;
+
+    TagInfo from_stream(QDataStream& stream, BinaryStringTable& table) override;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYTAGINFO_H
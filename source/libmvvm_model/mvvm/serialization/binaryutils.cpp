@@ -0,0 +1,27 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QDataStream>
+#include <mvvm/serialization/binaryutils.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+void BinaryUtils::SetupStream(QDataStream& stream)
+{
+    stream.setVersion(QDataStream::Qt_5_12);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
+}
+
+void BinaryUtils::CheckStatus(const QDataStream& stream, const std::string& context)
+{
+    if (stream.status() != QDataStream::Ok)
+        throw std::runtime_error(context + " -> Error. Corrupted or truncated binary data.");
+}
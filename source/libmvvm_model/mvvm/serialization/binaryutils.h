@@ -0,0 +1,34 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYUTILS_H
+#define MVVM_SERIALIZATION_BINARYUTILS_H
+
+#include <mvvm/model_export.h>
+#include <string>
+
+class QDataStream;
+
+namespace ModelView
+{
+
+namespace BinaryUtils
+{
+
+//! Sets up version and byte order of the stream used in binary serialization.
+MVVM_MODEL_EXPORT void SetupStream(QDataStream& stream);
+
+//! Throws if the stream is in failed state, given context is used in error message.
+MVVM_MODEL_EXPORT void CheckStatus(const QDataStream& stream, const std::string& context);
+
+} // namespace BinaryUtils
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYUTILS_H
@@ -0,0 +1,290 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QColor>
+#include <QDataStream>
+#include <QIODevice>
+#include <QSysInfo>
+#include <QVariant>
+#include <algorithm>
+#include <limits>
+#include <mvvm/core/uniqueid.h>
+#include <mvvm/model/comboproperty.h>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/externalproperty.h>
+#include <mvvm/model/variant-constants.h>
+#include <mvvm/serialization/binarystringtable.h>
+#include <mvvm/serialization/binaryutils.h>
+#include <mvvm/serialization/binaryvariant.h>
+#include <mvvm/serialization/jsonutils.h>
+#include <mvvm/utils/reallimits.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace
+{
+
+//! Maximum number of bytes passed to QDataStream raw read/write at once, since it accepts int.
+const std::size_t max_chunk_size = 1 << 24;
+
+void write_string(const std::string& str, QDataStream& stream, BinaryStringTable& table)
+{
+    table.write(str, stream);
+}
+
+std::string read_string(QDataStream& stream, BinaryStringTable& table)
+{
+    return table.read(stream);
+}
+
+//! Writes color as validity flag followed by ARGB value.
+
+void write_color(const QColor& color, QDataStream& stream)
+{
+    stream << color.isValid() << static_cast<quint32>(color.rgba());
+}
+
+QColor read_color(QDataStream& stream)
+{
+    bool is_valid{false};
+    quint32 rgba{0};
+    stream >> is_valid >> rgba;
+    return is_valid ? QColor::fromRgba(rgba) : QColor();
+}
+
+void from_invalid(const QVariant&, QDataStream&, BinaryStringTable&) {}
+
+QVariant to_invalid(QDataStream&, BinaryStringTable&)
+{
+    return QVariant();
+}
+
+void from_bool(const QVariant& variant, QDataStream& stream, BinaryStringTable&)
+{
+    stream << variant.value<bool>();
+}
+
+QVariant to_bool(QDataStream& stream, BinaryStringTable&)
+{
+    bool value{false};
+    stream >> value;
+    return QVariant::fromValue(value);
+}
+
+void from_int(const QVariant& variant, QDataStream& stream, BinaryStringTable&)
+{
+    stream << static_cast<qint32>(variant.value<int>());
+}
+
+QVariant to_int(QDataStream& stream, BinaryStringTable&)
+{
+    qint32 value{0};
+    stream >> value;
+    return QVariant::fromValue(static_cast<int>(value));
+}
+
+void from_string(const QVariant& variant, QDataStream& stream, BinaryStringTable& table)
+{
+    write_string(*static_cast<const std::string*>(variant.constData()), stream, table);
+}
+
+QVariant to_string(QDataStream& stream, BinaryStringTable& table)
+{
+    return QVariant::fromValue(read_string(stream, table));
+}
+
+void from_double(const QVariant& variant, QDataStream& stream, BinaryStringTable&)
+{
+    stream << variant.value<double>();
+}
+
+QVariant to_double(QDataStream& stream, BinaryStringTable&)
+{
+    double value{0.0};
+    stream >> value;
+    return QVariant::fromValue(value);
+}
+
+// --- std::vector<double> ------
+
+//! Writes number of elements followed by raw little-endian data. On little-endian hosts
+//! the array is copied into the stream in large chunks.
+
+void from_vector_double(const QVariant& variant, QDataStream& stream, BinaryStringTable&)
+{
+    const auto& data = *static_cast<const std::vector<double>*>(variant.constData());
+    if (data.size() > std::numeric_limits<quint32>::max())
+        throw std::runtime_error("BinaryVariant::to_stream() -> Error. Array is too large.");
+
+    stream << static_cast<quint32>(data.size());
+
+    if (QSysInfo::ByteOrder == QSysInfo::LittleEndian) {
+        auto bytes = reinterpret_cast<const char*>(data.data());
+        std::size_t remaining = data.size() * sizeof(double);
+        while (remaining > 0) {
+            const auto chunk = std::min(remaining, max_chunk_size);
+            if (stream.writeRawData(bytes, static_cast<int>(chunk)) != static_cast<int>(chunk))
+                throw std::runtime_error(
+                    "BinaryVariant::to_stream() -> Error. Can't write the array.");
+            bytes += chunk;
+            remaining -= chunk;
+        }
+    } else {
+        for (auto x : data)
+            stream << x;
+    }
+}
+
+QVariant to_vector_double(QDataStream& stream, BinaryStringTable&)
+{
+    quint32 size{0};
+    stream >> size;
+    BinaryUtils::CheckStatus(stream, "BinaryVariant::from_stream()");
+
+    // checking declared size before allocation, to not be fooled by corrupted data
+    const std::size_t byte_count = static_cast<std::size_t>(size) * sizeof(double);
+    auto device = stream.device();
+    if (device && !device->isSequential()
+        && device->bytesAvailable() < static_cast<qint64>(byte_count))
+        throw std::runtime_error("BinaryVariant::from_stream() -> Error. Truncated array.");
+
+    std::vector<double> data(size);
+    if (QSysInfo::ByteOrder == QSysInfo::LittleEndian) {
+        auto bytes = reinterpret_cast<char*>(data.data());
+        std::size_t remaining = byte_count;
+        while (remaining > 0) {
+            const auto chunk = std::min(remaining, max_chunk_size);
+            if (stream.readRawData(bytes, static_cast<int>(chunk)) != static_cast<int>(chunk))
+                throw std::runtime_error(
+                    "BinaryVariant::from_stream() -> Error. Truncated array.");
+            bytes += chunk;
+            remaining -= chunk;
+        }
+    } else {
+        for (auto& x : data)
+            stream >> x;
+    }
+    return QVariant::fromValue(data);
+}
+
+// --- ComboProperty ------
+
+void from_comboproperty(const QVariant& variant, QDataStream& stream, BinaryStringTable& table)
+{
+    auto combo = variant.value<ComboProperty>();
+    write_string(combo.stringOfValues(), stream, table);
+    write_string(combo.stringOfSelections(), stream, table);
+}
+
+QVariant to_comboproperty(QDataStream& stream, BinaryStringTable& table)
+{
+    ComboProperty combo;
+    combo.setStringOfValues(read_string(stream, table));
+    combo.setStringOfSelections(read_string(stream, table));
+    return QVariant::fromValue(combo);
+}
+
+// --- QColor ------
+
+void from_qcolor(const QVariant& variant, QDataStream& stream, BinaryStringTable&)
+{
+    write_color(variant.value<QColor>(), stream);
+}
+
+QVariant to_qcolor(QDataStream& stream, BinaryStringTable&)
+{
+    return QVariant::fromValue(read_color(stream));
+}
+
+// --- ExternalProperty ------
+
+void from_extproperty(const QVariant& variant, QDataStream& stream, BinaryStringTable& table)
+{
+    auto extprop = variant.value<ExternalProperty>();
+    write_string(extprop.text(), stream, table);
+    write_color(extprop.color(), stream);
+    write_string(extprop.identifier(), stream, table);
+}
+
+QVariant to_extproperty(QDataStream& stream, BinaryStringTable& table)
+{
+    const std::string text = read_string(stream, table);
+    const QColor color = read_color(stream);
+    const std::string id = read_string(stream, table);
+    return QVariant::fromValue(ExternalProperty(text, color, id));
+}
+
+// --- RealLimits ------
+
+void from_reallimits(const QVariant& variant, QDataStream& stream, BinaryStringTable& table)
+{
+    auto limits = variant.value<RealLimits>();
+    write_string(JsonUtils::ToString(limits), stream, table);
+    stream << limits.lowerLimit() << limits.upperLimit();
+}
+
+QVariant to_reallimits(QDataStream& stream, BinaryStringTable& table)
+{
+    const std::string text = read_string(stream, table);
+    double min{0.0};
+    double max{0.0};
+    stream >> min >> max;
+    return QVariant::fromValue(JsonUtils::CreateLimits(text, min, max));
+}
+
+} // namespace
+
+BinaryVariant::BinaryVariant()
+{
+    m_converters[Constants::invalid_type_name] = {from_invalid, to_invalid};
+    m_converters[Constants::bool_type_name] = {from_bool, to_bool};
+    m_converters[Constants::int_type_name] = {from_int, to_int};
+    m_converters[Constants::string_type_name] = {from_string, to_string};
+    m_converters[Constants::double_type_name] = {from_double, to_double};
+    m_converters[Constants::vector_double_type_name] = {from_vector_double, to_vector_double};
+    m_converters[Constants::comboproperty_type_name] = {from_comboproperty, to_comboproperty};
+    m_converters[Constants::qcolor_type_name] = {from_qcolor, to_qcolor};
+    m_converters[Constants::extproperty_type_name] = {from_extproperty, to_extproperty};
+    m_converters[Constants::reallimits_type_name] = {from_reallimits, to_reallimits};
+}
+
+//! Writes variant into the stream. UniqueId is written in its textual form, so the stream
+//! doesn't depend on identifier_type the library was built with.
+
+void BinaryVariant::to_stream(const QVariant& variant, QDataStream& stream,
+                              BinaryStringTable& table)
+{
+    if (Utils::IsUniqueIdVariant(variant))
+        return to_stream(QVariant::fromValue(variant.value<UniqueId>().toString()), stream, table);
+
+    const std::string type_name = Utils::VariantName(variant);
+
+    auto it = m_converters.find(type_name);
+    if (it == m_converters.end())
+        throw std::runtime_error("BinaryVariant::to_stream() -> Error. Unknown variant type '"
+                                 + type_name + "'.");
+
+    write_string(type_name, stream, table);
+    it->second.variant_to_stream(variant, stream, table);
+}
+
+QVariant BinaryVariant::from_stream(QDataStream& stream, BinaryStringTable& table)
+{
+    const std::string type_name = read_string(stream, table);
+
+    auto it = m_converters.find(type_name);
+    if (it == m_converters.end())
+        throw std::runtime_error("BinaryVariant::from_stream() -> Error. Unknown variant type '"
+                                 + type_name + "' in binary data.");
+
+    auto result = it->second.stream_to_variant(stream, table);
+    BinaryUtils::CheckStatus(stream, "BinaryVariant::from_stream()");
+    return result;
+}
@@ -0,0 +1,46 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYVARIANT_H
+#define MVVM_SERIALIZATION_BINARYVARIANT_H
+
+#include <functional>
+#include <map>
+#include <mvvm/serialization/binaryconverterinterfaces.h>
+#include <string>
+
+namespace ModelView
+{
+
+//! Default converter between QVariant and binary stream.
+//! Variant is written as the index of its type name in the string table, followed by the value.
+//! Arrays of doubles are written as raw little-endian data.
+
+class MVVM_MODEL_EXPORT BinaryVariant : public BinaryVariantInterface
+{
+public:
+    BinaryVariant();
+
+    void to_stream(const QVariant& variant, QDataStream& stream,
+                   BinaryStringTable& table) override;
+
+    QVariant from_stream(QDataStream& stream, BinaryStringTable& table) override;
+
+private:
+    struct Converters {
+        std::function<void(const QVariant&, QDataStream&, BinaryStringTable&)> variant_to_stream;
+        std::function<QVariant(QDataStream&, BinaryStringTable&)> stream_to_variant;
+    };
+
+    std::map<std::string, Converters> m_converters;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYVARIANT_H
@@ -0,0 +1,183 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QtEndian>
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <limits>
+#include <mvvm/model/lazydata.h>
+#include <mvvm/serialization/blobstorage.h>
+#include <mvvm/utils/fileutils.h>
+#include <set>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace
+{
+const std::string blob_extension = ".bin";
+
+//! Returns identifier with all characters, which are not safe in file names, removed.
+std::string sanitized(const std::string& identifier)
+{
+    std::string result;
+    std::copy_if(identifier.begin(), identifier.end(), std::back_inserter(result),
+                 [](char ch) { return std::isalnum(static_cast<unsigned char>(ch)) || ch == '-'; });
+    return result;
+}
+
+//! Returns true if blob name can't point outside of the storage directory.
+bool is_valid_name(const std::string& name)
+{
+    auto is_allowed = [](char ch) {
+        return std::isalnum(static_cast<unsigned char>(ch)) || ch == '-' || ch == '_' || ch == '.';
+    };
+    return !name.empty() && name.front() != '.'
+           && std::all_of(name.begin(), name.end(), is_allowed);
+}
+
+} // namespace
+
+struct BlobStorage::BlobStorageImpl {
+    std::string dirname;
+    int threshold{defaultThreshold};
+    std::set<std::string> used_blobs; //! blobs referenced since construction
+
+    BlobStorageImpl(std::string dirname) : dirname(std::move(dirname)) {}
+};
+
+BlobStorage::BlobStorage(const std::string& dirname)
+    : p_impl(std::make_unique<BlobStorageImpl>(dirname))
+{
+}
+
+BlobStorage::~BlobStorage() = default;
+
+std::string BlobStorage::dirName() const
+{
+    return p_impl->dirname;
+}
+
+//! Sets minimal number of elements in array to go into the blob.
+
+void BlobStorage::setThreshold(int size)
+{
+    p_impl->threshold = size;
+}
+
+int BlobStorage::threshold() const
+{
+    return p_impl->threshold;
+}
+
+//! Writes array into the blob, if the blob with the same content doesn't exist yet.
+//! Returns the name of the blob.
+
+std::string BlobStorage::store(const std::string& identifier, const std::vector<double>& values)
+{
+    const qint64 byte_count = static_cast<qint64>(values.size() * sizeof(double));
+    if (byte_count > std::numeric_limits<int>::max())
+        throw std::runtime_error("BlobStorage::store() -> Error. Array is too large.");
+
+    // on little-endian machines array is used as it is, without copying
+    QByteArray bytes;
+    if (QSysInfo::ByteOrder == QSysInfo::LittleEndian) {
+        bytes = QByteArray::fromRawData(reinterpret_cast<const char*>(values.data()),
+                                        static_cast<int>(byte_count));
+    } else {
+        bytes.resize(static_cast<int>(byte_count));
+        qToLittleEndian<quint64>(values.data(), static_cast<qsizetype>(values.size()),
+                                 bytes.data());
+    }
+
+    auto hash = QCryptographicHash::hash(bytes, QCryptographicHash::Sha1).toHex().toStdString();
+    auto name = sanitized(identifier) + "_" + hash + blob_extension;
+    p_impl->used_blobs.insert(name);
+
+    auto path = Utils::join(p_impl->dirname, name);
+    if (Utils::exists(path))
+        return name;
+
+    QSaveFile file(QString::fromStdString(path));
+    if (!file.open(QIODevice::WriteOnly) || file.write(bytes) != bytes.size() || !file.commit())
+        throw std::runtime_error("BlobStorage::store() -> Error. Can't write the file '" + path
+                                 + "'.");
+
+    return name;
+}
+
+//! Reads array of given size from the blob.
+
+std::vector<double> BlobStorage::load(const std::string& blob_name, size_t size) const
+{
+    return lazyLoad(blob_name, size).read();
+}
+
+//! Returns handle to the array in the blob, the array will be read on first access.
+//! Existence of the blob and its size are checked immediately.
+
+LazyData BlobStorage::lazyLoad(const std::string& blob_name, size_t size) const
+{
+    if (!is_valid_name(blob_name))
+        throw std::runtime_error("BlobStorage::lazyLoad() -> Error. Invalid blob name '"
+                                 + blob_name + "'.");
+
+    auto path = Utils::join(p_impl->dirname, blob_name);
+    QFileInfo info(QString::fromStdString(path));
+    if (!info.exists())
+        throw std::runtime_error("BlobStorage::lazyLoad() -> Error. Can't find the file '" + path
+                                 + "'.");
+
+    if (info.size() != static_cast<qint64>(size * sizeof(double)))
+        throw std::runtime_error("BlobStorage::lazyLoad() -> Error. Corrupted blob '" + path
+                                 + "'.");
+
+    return LazyData(path, 0, size);
+}
+
+//! Returns the name of the blob, if given handle refers to the existing blob of this storage.
+//! The blob is marked as used in that case, so the array doesn't need to be read and written
+//! again. Returns empty string otherwise.
+
+std::string BlobStorage::adopt(const LazyData& data)
+{
+    if (data.offset() != 0)
+        return {};
+
+    auto name = Utils::base_name(data.fileName()) + blob_extension;
+    if (!is_valid_name(name) || Utils::join(p_impl->dirname, name) != data.fileName()
+        || !Utils::exists(data.fileName()))
+        return {};
+
+    p_impl->used_blobs.insert(name);
+    return name;
+}
+
+//! Removes blobs which weren't referenced by the storage since its construction.
+//! Should be called after the document referring to the blobs has been written. Blobs which are
+//! still referred by LazyData handles (i.e. by items on undo stack) are kept.
+
+void BlobStorage::removeUnused()
+{
+    if (!Utils::exists(p_impl->dirname))
+        return;
+
+    for (const auto& found : Utils::FindFiles(p_impl->dirname, blob_extension)) {
+        auto name = Utils::base_name(found) + blob_extension;
+        if (p_impl->used_blobs.find(name) != p_impl->used_blobs.end())
+            continue;
+        if (auto path = Utils::join(p_impl->dirname, name); !LazyData::isFileInUse(path))
+            Utils::remove(path);
+    }
+}
@@ -0,0 +1,63 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BLOBSTORAGE_H
+#define MVVM_SERIALIZATION_BLOBSTORAGE_H
+
+#include <memory>
+#include <mvvm/model_export.h>
+#include <string>
+#include <vector>
+
+namespace ModelView
+{
+
+class LazyData;
+
+/*!
+@class BlobStorage
+@brief Keeps large arrays of doubles in separate binary files (blobs) in the given directory.
+
+Blob file contains raw little-endian IEEE doubles. Its name is made of the identifier of the
+owning item and the hash of the content, so the blob is written only when the content changes.
+Blobs are memory-mapped on reading. Arrays can be also provided in the form of LazyData handles,
+to be read on first access.
+*/
+
+class MVVM_MODEL_EXPORT BlobStorage
+{
+public:
+    static const int defaultThreshold = 65536;
+
+    explicit BlobStorage(const std::string& dirname);
+    ~BlobStorage();
+
+    std::string dirName() const;
+
+    void setThreshold(int size);
+    int threshold() const;
+
+    std::string store(const std::string& identifier, const std::vector<double>& values);
+
+    std::vector<double> load(const std::string& blob_name, size_t size) const;
+
+    LazyData lazyLoad(const std::string& blob_name, size_t size) const;
+
+    std::string adopt(const LazyData& data);
+
+    void removeUnused();
+
+private:
+    struct BlobStorageImpl;
+    std::unique_ptr<BlobStorageImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BLOBSTORAGE_H
@@ -0,0 +1,59 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/core/uniqueidgenerator.h>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/itemfactoryinterface.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionitemcontainer.h>
+#include <mvvm/model/sessionitemdata.h>
+#include <mvvm/model/sessionitemtags.h>
+#include <mvvm/serialization/cloneitemcopystrategy.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+CloneItemCopyStrategy::CloneItemCopyStrategy(const ItemFactoryInterface* item_factory)
+    : m_factory(item_factory)
+{
+    if (!m_factory)
+        throw std::runtime_error("CloneItemCopyStrategy::CloneItemCopyStrategy() -> Error. "
+                                 "Uninitialized factory.");
+}
+
+std::unique_ptr<SessionItem> CloneItemCopyStrategy::createCopy(const SessionItem* item) const
+{
+    return item ? clone_item(*item, nullptr) : std::unique_ptr<SessionItem>();
+}
+
+//! Creates deep copy of the item with new identifiers, and attaches it to given parent.
+
+std::unique_ptr<SessionItem> CloneItemCopyStrategy::clone_item(const SessionItem& item,
+                                                               SessionItem* parent) const
+{
+    auto result = m_factory->createItem(item.modelType());
+    result->setParent(parent);
+
+    auto data = std::make_unique<SessionItemData>(*item.itemData());
+
+    auto tags = std::make_unique<SessionItemTags>();
+    for (auto container : *item.itemTags()) {
+        const auto& tag_info = container->tagInfo();
+        tags->registerTag(tag_info);
+        for (auto child : *container)
+            tags->insertItem(clone_item(*child, result.get()).release(),
+                             TagRow::append(tag_info.name()));
+    }
+    tags->setDefaultTag(item.itemTags()->defaultTag());
+
+    result->setDataAndTags(std::move(data), std::move(tags));
+    result->setData(UniqueIdGenerator::generate(), ItemDataRole::IDENTIFIER);
+
+    return result;
+}
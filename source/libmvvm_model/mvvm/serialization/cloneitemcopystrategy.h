@@ -0,0 +1,41 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_CLONEITEMCOPYSTRATEGY_H
+#define MVVM_SERIALIZATION_CLONEITEMCOPYSTRATEGY_H
+
+#include <memory>
+#include <mvvm/serialization/itemcopystrategy.h>
+
+namespace ModelView
+{
+
+class SessionItem;
+class ItemFactoryInterface;
+
+//! Provide SessionItem copying by direct cloning of item's data and tags.
+//! Items are created using factory, their data is copied as it is (large variants are implicitly
+//! shared), tags are rebuilt with cloned children. Identifiers of all items are regenerated.
+
+class MVVM_MODEL_EXPORT CloneItemCopyStrategy : public ItemCopyStrategy
+{
+public:
+    CloneItemCopyStrategy(const ItemFactoryInterface* item_factory);
+
+    std::unique_ptr<SessionItem> createCopy(const SessionItem* item) const override;
+
+private:
+    std::unique_ptr<SessionItem> clone_item(const SessionItem& item, SessionItem* parent) const;
+
+    const ItemFactoryInterface* m_factory;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_CLONEITEMCOPYSTRATEGY_H
@@ -0,0 +1,74 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <mvvm/model/itemutils.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/serialization/detacheditembackupstrategy.h>
+#include <mvvm/serialization/jsonitembackupstrategy.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+struct DetachedItemBackupStrategy::DetachedItemBackupStrategyImpl {
+    mutable std::unique_ptr<SessionItem> m_item; //! kept item, given away on restore
+    JsonItemBackupStrategy m_json_strategy;      //! to save copies of items we don't own
+    bool m_has_json_copy{false};
+
+    DetachedItemBackupStrategyImpl(const ItemFactoryInterface* item_factory)
+        : m_json_strategy(item_factory)
+    {
+    }
+};
+
+DetachedItemBackupStrategy::DetachedItemBackupStrategy(const ItemFactoryInterface* item_factory)
+    : p_impl(std::make_unique<DetachedItemBackupStrategyImpl>(item_factory))
+{
+}
+
+DetachedItemBackupStrategy::~DetachedItemBackupStrategy() = default;
+
+//! Returns kept item. Kept item can be restored only once, until it is kept again.
+//! If the item was saved using saveItem(), returns its new copy.
+
+std::unique_ptr<SessionItem> DetachedItemBackupStrategy::restoreItem() const
+{
+    if (p_impl->m_item)
+        return std::move(p_impl->m_item);
+
+    if (p_impl->m_has_json_copy)
+        return p_impl->m_json_strategy.restoreItem();
+
+    throw std::runtime_error(
+        "DetachedItemBackupStrategy::restoreItem() -> Error. Nothing to restore.");
+}
+
+//! Saves a copy of the item, which stays in the ownership of the caller.
+
+void DetachedItemBackupStrategy::saveItem(const SessionItem* item)
+{
+    p_impl->m_item.reset();
+    p_impl->m_json_strategy.saveItem(item);
+    p_impl->m_has_json_copy = true;
+}
+
+//! Keeps the item. Listeners of the item and its children are notified as if the item was deleted.
+
+void DetachedItemBackupStrategy::keepItem(std::unique_ptr<SessionItem> item)
+{
+    if (!item)
+        throw std::runtime_error("DetachedItemBackupStrategy::keepItem() -> Error. No item.");
+
+    if (item->parent() || item->model())
+        throw std::runtime_error("DetachedItemBackupStrategy::keepItem() -> Error. "
+                                 "Item should be detached from the model.");
+
+    Utils::iterate(item.get(), [](SessionItem* child) { child->resetMapper(); });
+    p_impl->m_item = std::move(item);
+    p_impl->m_has_json_copy = false;
+}
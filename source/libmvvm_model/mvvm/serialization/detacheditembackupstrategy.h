@@ -0,0 +1,51 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_DETACHEDITEMBACKUPSTRATEGY_H
+#define MVVM_SERIALIZATION_DETACHEDITEMBACKUPSTRATEGY_H
+
+#include <memory>
+#include <mvvm/serialization/itembackupstrategy.h>
+
+namespace ModelView
+{
+
+class SessionItem;
+class ItemFactoryInterface;
+
+/*!
+@class DetachedItemBackupStrategy
+@brief Provides backup of SessionItem by keeping the item itself, detached from the model.
+
+Item given to keepItem() is stored as it is, without serialization, and handed back by the
+next call to restoreItem(). Before storing, all item mappers of the subtree are destroyed, so
+listeners get "item destroyed" notification as if the item was deleted. Items given to
+saveItem() are copied using json converter.
+*/
+
+class MVVM_MODEL_EXPORT DetachedItemBackupStrategy : public ItemBackupStrategy
+{
+public:
+    DetachedItemBackupStrategy(const ItemFactoryInterface* item_factory);
+    ~DetachedItemBackupStrategy() override;
+
+    std::unique_ptr<SessionItem> restoreItem() const override;
+
+    void saveItem(const SessionItem* item) override;
+
+    void keepItem(std::unique_ptr<SessionItem> item) override;
+
+private:
+    struct DetachedItemBackupStrategyImpl;
+    std::unique_ptr<DetachedItemBackupStrategyImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_DETACHEDITEMBACKUPSTRATEGY_H
@@ -30,6 +30,10 @@ public:
 
     //! Save item's content.
     virtual void saveItem(const SessionItem*) = 0;
+
+    //! Save item's content, taking ownership of the item, which has been already taken
+    //! from the model.
+    virtual void keepItem(std::unique_ptr<SessionItem> item) = 0;
 };
 
 } // namespace ModelView
@@ -8,78 +8,172 @@
 // ************************************************************************** //
 
 #include <QFile>
-#include <QJsonArray>
-#include <QJsonDocument>
-#include <QJsonObject>
+#include <QSaveFile>
+#include <mvvm/model/modelutils.h>
+#include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
+#include <mvvm/serialization/blobstorage.h>
 #include <mvvm/serialization/jsondocument.h>
 #include <mvvm/serialization/jsonmodelconverter.h>
+#include <mvvm/serialization/jsonstreamreader.h>
+#include <mvvm/serialization/jsonstreamwriter.h>
+#include <mvvm/utils/fileutils.h>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
 
 using namespace ModelView;
 
+namespace
+{
+const std::string json_extension = ".json";
+const std::string blobs_extension = ".blobs";
+
+//! Returns name of the directory with blobs for given json file: model.json -> model.blobs
+std::string blob_dirname(const std::string& file_name)
+{
+    const auto length = json_extension.size();
+    const bool has_extension =
+        file_name.size() > length
+        && file_name.compare(file_name.size() - length, length, json_extension) == 0;
+    auto base_name = has_extension ? file_name.substr(0, file_name.size() - length) : file_name;
+    return base_name + blobs_extension;
+}
+} // namespace
+
 struct JsonDocument::JsonDocumentImpl {
     std::vector<SessionModel*> models;
-    JsonDocumentImpl(const std::initializer_list<ModelView::SessionModel*>& models) : models(models)
+    bool use_blob_storage{false};
+    bool use_packed_arrays{false};
+    bool compress_packed_arrays{false};
+    JsonDocumentImpl(const std::initializer_list<ModelView::SessionModel*>& models,
+                     bool use_blob_storage, bool use_packed_arrays, bool compress_packed_arrays)
+        : models(models), use_blob_storage(use_blob_storage), use_packed_arrays(use_packed_arrays),
+          compress_packed_arrays(compress_packed_arrays)
+    {
+    }
+
+    //! Writes all models into the device. Items are written as they are visited.
+    void write(QIODevice& device, BlobStorage* blob_storage) const
     {
+        ModelView::JsonModelConverter converter(blob_storage, use_packed_arrays,
+                                                compress_packed_arrays);
+        JsonStreamWriter writer(&device);
+
+        writer.beginArray();
+        for (auto model : models)
+            converter.model_to_stream(*model, writer);
+        writer.endArray();
+    }
+
+    //! Reads all models from the device and returns the function to populate them. Items are
+    //! built while the device is read, without intermediate json document.
+    std::function<void()> read(QIODevice& device, BlobStorage* blob_storage) const
+    {
+        auto throw_count_mismatch = [this](int json_count) {
+            std::ostringstream ostr;
+            ostr << "Error in JsonDocument: number of application models " << models.size()
+                 << " and number of json models " << json_count << " doesn't match";
+            throw std::runtime_error(ostr.str());
+        };
+
+        ModelView::JsonModelConverter converter(blob_storage);
+        JsonStreamReader reader(&device);
+
+        if (reader.atEnd())
+            throw_count_mismatch(0);
+
+        auto items = std::make_shared<std::vector<std::vector<std::unique_ptr<SessionItem>>>>();
+        reader.beginArray();
+        for (auto model : models) {
+            if (!reader.hasNextElement())
+                throw_count_mismatch(static_cast<int>(items->size()));
+            items->push_back(converter.stream_to_items(reader, *model));
+        }
+
+        if (reader.hasNextElement())
+            throw_count_mismatch(static_cast<int>(items->size()) + 1);
+
+        return [models = models, items]() {
+            for (size_t i = 0; i < models.size(); ++i)
+                Utils::PopulateModel(models[i], std::move(items->at(i)));
+        };
     }
 };
 
-JsonDocument::JsonDocument(std::initializer_list<ModelView::SessionModel*> models)
-    : p_impl(std::make_unique<JsonDocumentImpl>(models))
+//! Constructor of the document.
+//! @param models: models to save and load.
+//! @param use_blob_storage: large arrays are saved in separate binary files if true.
+//! @param use_packed_arrays: large arrays of doubles are saved in packed form if true.
+//! @param compress_packed_arrays: packed arrays are compressed if true.
+
+JsonDocument::JsonDocument(std::initializer_list<ModelView::SessionModel*> models,
+                           bool use_blob_storage, bool use_packed_arrays,
+                           bool compress_packed_arrays)
+    : p_impl(std::make_unique<JsonDocumentImpl>(models, use_blob_storage, use_packed_arrays,
+                                                compress_packed_arrays))
 {
 }
 
-//! Saves models on disk.
+//! Saves models on disk. Items are written into the file as they are visited.
+//! Content goes to a temporary file first, which then atomically replaces the target.
+//! If blob storage is used, blobs which are not referenced anymore are removed afterwards.
+
 void JsonDocument::save(const std::string& file_name) const
 {
-    ModelView::JsonModelConverter converter;
-    QJsonArray array;
+    QSaveFile file(QString::fromStdString(file_name));
+
+    if (!file.open(QIODevice::WriteOnly))
+        throw std::runtime_error("Error in JsonDocument: can't save the file '" + file_name + "'");
 
-    for (auto model : p_impl->models) {
-        QJsonObject object;
-        converter.model_to_json(*model, object);
-        array.push_back(object);
+    std::unique_ptr<BlobStorage> blob_storage;
+    if (p_impl->use_blob_storage) {
+        blob_storage = std::make_unique<BlobStorage>(blob_dirname(file_name));
+        Utils::create_directory(blob_storage->dirName());
     }
 
-    QJsonDocument document(array);
-    QFile file(QString::fromStdString(file_name));
+    p_impl->write(file, blob_storage.get());
 
-    if (!file.open(QIODevice::WriteOnly))
+    if (!file.commit())
         throw std::runtime_error("Error in JsonDocument: can't save the file '" + file_name + "'");
 
-    file.write(document.toJson());
-
-    file.close();
+    if (blob_storage)
+        blob_storage->removeUnused();
 }
 
 //! Loads models from disk. If models have some data already, it will be rewritten.
 
 void JsonDocument::load(const std::string& file_name)
+{
+    prepare_load(file_name)();
+}
+
+//! Reads all models from disk and returns the function to populate them. Models are not
+//! modified if the file can't be read.
+
+std::function<void()> JsonDocument::prepare_load(const std::string& file_name)
 {
     QFile file(QString::fromStdString(file_name));
     if (!file.open(QIODevice::ReadOnly))
         throw std::runtime_error("Error in JsonDocument: can't read the file '" + file_name + "'");
 
-    auto document = QJsonDocument::fromJson(file.readAll());
-    auto array = document.array();
-    if (array.size() != static_cast<int>(p_impl->models.size())) {
-        std::ostringstream ostr;
-        ostr << "Error in JsonDocument: number of application models " << p_impl->models.size()
-             << " and number of json models " << array.size() << " doesn't match";
-        throw std::runtime_error(ostr.str());
-    }
+    // blobs are read from the storage whenever json refers to them
+    BlobStorage blob_storage(blob_dirname(file_name));
+    return p_impl->read(file, &blob_storage);
+}
 
-    ModelView::JsonModelConverter converter;
-    int index(0);
-    for (auto model : p_impl->models) {
-        converter.json_to_model(array.at(index).toObject(), *model);
-        ++index;
-    }
+//! Writes models into the device. Blob storage isn't used, all arrays are written inline.
 
-    file.close();
+void JsonDocument::save(QIODevice& device) const
+{
+    p_impl->write(device, nullptr);
+}
+
+//! Reads models from the device and returns the function to populate them.
+
+std::function<void()> JsonDocument::prepare_load(QIODevice& device)
+{
+    return p_impl->read(device, nullptr);
 }
 
 JsonDocument::~JsonDocument() = default;
@@ -27,11 +27,16 @@ class SessionModel;
 class MVVM_MODEL_EXPORT JsonDocument : public ModelDocumentInterface
 {
 public:
-    JsonDocument(std::initializer_list<SessionModel*> models);
+    JsonDocument(std::initializer_list<SessionModel*> models, bool use_blob_storage = false,
+                 bool use_packed_arrays = false, bool compress_packed_arrays = false);
     ~JsonDocument() override;
 
     void save(const std::string& file_name) const override;
     void load(const std::string& file_name) override;
+    std::function<void()> prepare_load(const std::string& file_name) override;
+
+    void save(QIODevice& device) const override;
+    std::function<void()> prepare_load(QIODevice& device) override;
 
 private:
     struct JsonDocumentImpl;
@@ -36,3 +36,10 @@ void JsonItemBackupStrategy::saveItem(const SessionItem* item)
 {
     p_impl->m_json = p_impl->m_converter->to_json(item);
 }
+
+//! Saves content of the item, the item itself is deleted.
+
+void JsonItemBackupStrategy::keepItem(std::unique_ptr<SessionItem> item)
+{
+    saveItem(item.get());
+}
@@ -31,6 +31,8 @@ public:
 
     void saveItem(const SessionItem* item) override;
 
+    void keepItem(std::unique_ptr<SessionItem> item) override;
+
 private:
     struct JsonItemBackupStrategyImpl;
     std::unique_ptr<JsonItemBackupStrategyImpl> p_impl;
@@ -19,8 +19,12 @@
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/serialization/jsonitemconverter.h>
 #include <mvvm/serialization/jsonitemdata.h>
+#include <mvvm/serialization/jsonstreamreader.h>
+#include <mvvm/serialization/jsonstreamwriter.h>
 #include <mvvm/serialization/jsontaginfo.h>
+#include <mvvm/serialization/jsonvariant.h>
 #include <stdexcept>
+#include <vector>
 
 namespace
 {
@@ -45,12 +49,22 @@ const QString JsonItemConverter::itemsKey = "items";
 //! @param factory: SessionItem factory.
 //! @param new_id_flag: generates exact item clones if false, generates new item's unique
 //! identifiers if true.
-
-JsonItemConverter::JsonItemConverter(const ItemFactoryInterface* factory, bool new_id_flag)
-    : m_itemdata_converter(std::make_unique<JsonItemData>()),
-      m_taginfo_converter(std::make_unique<JsonTagInfo>()), m_factory(factory),
+//! @param blob_storage: storage for large arrays, arrays are kept in json if nullptr.
+//! @param use_packed_arrays: large arrays of doubles kept in json are written in packed form.
+//! @param compress_packed_arrays: packed arrays are compressed.
+
+JsonItemConverter::JsonItemConverter(const ItemFactoryInterface* factory, bool new_id_flag,
+                                     BlobStorage* blob_storage, bool use_packed_arrays,
+                                     bool compress_packed_arrays)
+    : m_taginfo_converter(std::make_unique<JsonTagInfo>()), m_factory(factory),
       m_generate_new_identifiers(new_id_flag)
 {
+    auto itemdata_converter = std::make_unique<JsonItemData>();
+    itemdata_converter->set_blob_storage(blob_storage);
+    if (use_packed_arrays)
+        itemdata_converter->set_packing_threshold(JsonVariant::defaultPackingThreshold);
+    itemdata_converter->set_packing_compression(compress_packed_arrays);
+    m_itemdata_converter = std::move(itemdata_converter);
 }
 
 JsonItemConverter::~JsonItemConverter() = default;
@@ -68,6 +82,63 @@ std::unique_ptr<SessionItem> JsonItemConverter::from_json(const QJsonObject& jso
     return json_to_item(json);
 }
 
+//! Writes item directly into the stream, without building json object for the whole subtree.
+
+void JsonItemConverter::to_stream(const SessionItem* item, JsonStreamWriter& writer) const
+{
+    if (!item) {
+        writer.beginObject();
+        writer.endObject();
+        return;
+    }
+
+    item_to_stream(*item, writer);
+}
+
+//! Builds item from the stream. Memory consumption is limited by the data of a single item.
+
+std::unique_ptr<SessionItem> JsonItemConverter::from_stream(JsonStreamReader& reader) const
+{
+    std::string modelType;
+    std::unique_ptr<SessionItemData> data;
+    std::unique_ptr<SessionItemTags> tags;
+    bool is_valid{true};
+
+    // keys can go in any order, since QJsonDocument writes them sorted
+    reader.beginObject();
+    QString key;
+    while (reader.nextKey(key)) {
+        if (key == modelKey && modelType.empty()) {
+            modelType = reader.readString().toStdString();
+        } else if (key == itemDataKey && !data) {
+            auto json = reader.readValue();
+            is_valid = json.isArray();
+            if (!is_valid)
+                break;
+            data = m_itemdata_converter->get_data(json.toArray());
+        } else if (key == itemTagsKey && !tags) {
+            tags = stream_to_tags(reader);
+        } else {
+            is_valid = false;
+            break;
+        }
+    }
+
+    if (!is_valid || modelType.empty() || !data || !tags)
+        throw std::runtime_error(
+            "JsonItem::from_stream() -> Error. Given json object can't represent an SessionItem.");
+
+    auto result = m_factory->createItem(modelType);
+    for (auto child : tags->allitems())
+        child->setParent(result.get());
+    result->setDataAndTags(std::move(data), std::move(tags));
+
+    if (m_generate_new_identifiers)
+        result->setData(UniqueIdGenerator::generate(), ItemDataRole::IDENTIFIER);
+
+    return result;
+}
+
 //! Returns true if given json object represents SessionItem.
 
 bool JsonItemConverter::isSessionItem(const QJsonObject& json) const
@@ -163,6 +234,39 @@ QJsonObject JsonItemConverter::container_to_json(const SessionItemContainer& con
     return result;
 }
 
+// --- to stream ------------------------------------------------------------
+
+void JsonItemConverter::item_to_stream(const SessionItem& item, JsonStreamWriter& writer) const
+{
+    writer.beginObject();
+    writer.writeKey(modelKey);
+    writer.writeValue(QString::fromStdString(item.modelType()));
+    writer.writeKey(itemDataKey);
+    writer.writeValue(m_itemdata_converter->get_json(*item.itemData()));
+
+    writer.writeKey(itemTagsKey);
+    writer.beginObject();
+    writer.writeKey(defaultTagKey);
+    writer.writeValue(QString::fromStdString(item.itemTags()->defaultTag()));
+    writer.writeKey(containerKey);
+    writer.beginArray();
+    for (auto container : *item.itemTags()) {
+        writer.beginObject();
+        writer.writeKey(tagInfoKey);
+        writer.writeValue(m_taginfo_converter->to_json(container->tagInfo()));
+        writer.writeKey(itemsKey);
+        writer.beginArray();
+        for (auto child : *container)
+            item_to_stream(*child, writer);
+        writer.endArray();
+        writer.endObject();
+    }
+    writer.endArray();
+    writer.endObject();
+
+    writer.endObject();
+}
+
 // --- from json --------------------------------------------------------------
 
 std::unique_ptr<SessionItem> JsonItemConverter::json_to_item(const QJsonObject& json,
@@ -208,6 +312,80 @@ std::unique_ptr<SessionItemTags> JsonItemConverter::json_to_tags(const QJsonObje
     return result;
 }
 
+// --- from stream ------------------------------------------------------------
+
+std::unique_ptr<SessionItemTags> JsonItemConverter::stream_to_tags(JsonStreamReader& reader) const
+{
+    auto result = std::make_unique<SessionItemTags>();
+    bool has_default_tag{false};
+    bool has_containers{false};
+    bool is_valid{true};
+
+    reader.beginObject();
+    QString key;
+    while (reader.nextKey(key)) {
+        if (key == defaultTagKey && !has_default_tag) {
+            result->setDefaultTag(reader.readString().toStdString());
+            has_default_tag = true;
+        } else if (key == containerKey && !has_containers) {
+            reader.beginArray();
+            while (reader.hasNextElement())
+                stream_to_container(reader, *result);
+            has_containers = true;
+        } else {
+            is_valid = false;
+            break;
+        }
+    }
+
+    if (!is_valid || !has_default_tag || !has_containers)
+        throw std::runtime_error("JsonItem::stream_to_tags() -> Error. Given json object can't "
+                                 "represent an SessionItemTags.");
+
+    return result;
+}
+
+//! Reads container from the stream and adds it to tags. Items of the container can precede
+//! its tag info in the stream, they are kept aside until the tag is registered.
+
+void JsonItemConverter::stream_to_container(JsonStreamReader& reader, SessionItemTags& tags) const
+{
+    std::vector<std::unique_ptr<SessionItem>> items;
+    TagInfo tagInfo;
+    bool has_tag_info{false};
+    bool has_items{false};
+    bool is_valid{true};
+
+    reader.beginObject();
+    QString key;
+    while (reader.nextKey(key)) {
+        if (key == tagInfoKey && !has_tag_info) {
+            auto json = reader.readValue();
+            is_valid = json.isObject();
+            if (!is_valid)
+                break;
+            tagInfo = m_taginfo_converter->from_json(json.toObject());
+            has_tag_info = true;
+        } else if (key == itemsKey && !has_items) {
+            reader.beginArray();
+            while (reader.hasNextElement())
+                items.push_back(from_stream(reader));
+            has_items = true;
+        } else {
+            is_valid = false;
+            break;
+        }
+    }
+
+    if (!is_valid || !has_tag_info || !has_items)
+        throw std::runtime_error("JsonItem::stream_to_container() -> Error. Given json object "
+                                 "can't represent an SessionItemContainer.");
+
+    tags.registerTag(tagInfo);
+    for (auto& item : items)
+        tags.insertItem(item.release(), TagRow::append(tagInfo.name()));
+}
+
 // --- Utilities --------------------------------------------------------------
 
 namespace
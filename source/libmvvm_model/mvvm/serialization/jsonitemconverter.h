@@ -19,10 +19,13 @@ class QJsonObject;
 namespace ModelView
 {
 
+class BlobStorage;
 class SessionItem;
 class SessionItemContainer;
 class SessionItemTags;
 class ItemFactoryInterface;
+class JsonStreamReader;
+class JsonStreamWriter;
 
 //! Default converter between SessionItem and json object.
 
@@ -37,13 +40,19 @@ public:
     static const QString tagInfoKey;
     static const QString itemsKey;
 
-    JsonItemConverter(const ItemFactoryInterface* factory, bool new_id_flag = false);
+    JsonItemConverter(const ItemFactoryInterface* factory, bool new_id_flag = false,
+                      BlobStorage* blob_storage = nullptr, bool use_packed_arrays = false,
+                      bool compress_packed_arrays = false);
     ~JsonItemConverter() override;
 
     QJsonObject to_json(const SessionItem* item) const override;
 
     std::unique_ptr<SessionItem> from_json(const QJsonObject& json) const override;
 
+    void to_stream(const SessionItem* item, JsonStreamWriter& writer) const;
+
+    std::unique_ptr<SessionItem> from_stream(JsonStreamReader& reader) const;
+
     bool isSessionItem(const QJsonObject& json) const;
     bool isSessionItemTags(const QJsonObject& json) const;
     bool isSessionItemContainer(const QJsonObject& json) const;
@@ -58,6 +67,10 @@ private:
     std::unique_ptr<SessionItemTags> json_to_tags(const QJsonObject& json,
                                                   SessionItem* parent) const;
 
+    void item_to_stream(const SessionItem& item, JsonStreamWriter& writer) const;
+    std::unique_ptr<SessionItemTags> stream_to_tags(JsonStreamReader& reader) const;
+    void stream_to_container(JsonStreamReader& reader, SessionItemTags& tags) const;
+
     std::unique_ptr<JsonItemDataInterface> m_itemdata_converter;
     std::unique_ptr<JsonTagInfoInterface> m_taginfo_converter;
     const ItemFactoryInterface* m_factory;
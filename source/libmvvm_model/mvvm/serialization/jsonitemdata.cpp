@@ -9,9 +9,16 @@
 
 #include <QJsonArray>
 #include <QJsonObject>
+#include <mvvm/core/uniqueid.h>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/lazydata.h>
+#include <mvvm/model/mvvm_types.h>
 #include <mvvm/model/sessionitemdata.h>
+#include <mvvm/model/variant-constants.h>
+#include <mvvm/serialization/blobstorage.h>
 #include <mvvm/serialization/jsonitemdata.h>
 #include <mvvm/serialization/jsonvariant.h>
+#include <mvvm/utils/fileutils.h>
 #include <stdexcept>
 
 using namespace ModelView;
@@ -21,6 +28,32 @@ const QString ModelView::JsonItemData::variantKey = "variant";
 
 namespace
 {
+const QString variantTypeKey = "type";
+const QString variantValueKey = "value";
+const QString blobNameKey = "blob";
+const QString blobSizeKey = "size";
+
+//! Type name of std::vector<double> kept in the blob, used in json only.
+const QString blob_vector_double_type_name = "std::vector<double>:blob";
+
+QJsonObject blob_reference(const std::string& name, size_t size)
+{
+    QJsonObject json_blob;
+    json_blob[blobNameKey] = QString::fromStdString(name);
+    json_blob[blobSizeKey] = static_cast<double>(size);
+
+    QJsonObject result;
+    result[variantTypeKey] = blob_vector_double_type_name;
+    result[variantValueKey] = json_blob;
+    return result;
+}
+
+//! Returns the name of the blob from json object referring to it.
+std::string blob_name(const QJsonObject& json)
+{
+    return json[variantValueKey].toObject()[blobNameKey].toString().toStdString();
+}
+
 QJsonValue keyValue(const QJsonValue& parent_value, const QString& key)
 {
     const QJsonObject& parent_object = parent_value.toObject();
@@ -40,7 +73,7 @@ QJsonArray JsonItemData::get_json(const SessionItemData& data)
         QJsonObject object;
         if (role_to_save(x.m_role)) {
             object[roleKey] = x.m_role;
-            object[variantKey] = m_variant_converter->get_json(x.m_data);
+            object[variantKey] = variant_to_json(data, x.m_data);
             result.append(object);
         }
     }
@@ -56,7 +89,12 @@ std::unique_ptr<SessionItemData> JsonItemData::get_data(const QJsonArray& object
         if (!is_item_data(x.toObject()))
             throw std::runtime_error("JsonItemData::get_data() -> Invalid json object.");
         auto role = keyValue(x, roleKey).toInt();
-        auto variant = m_variant_converter->get_variant(keyValue(x, variantKey).toObject());
+        auto json_variant = keyValue(x, variantKey).toObject();
+        auto variant = json_variant[variantTypeKey] == blob_vector_double_type_name
+                           ? json_to_blob(json_variant)
+                           : m_variant_converter->get_variant(json_variant);
+        if (role == ItemDataRole::IDENTIFIER)
+            variant = Utils::IdentifierVariant(variant);
         result->setData(variant, role);
     }
 
@@ -78,6 +116,29 @@ void JsonItemData::set_role_filter(const std::vector<int>& roles)
     m_roles_to_filter = roles;
 }
 
+//! Sets storage for large arrays. Arrays exceeding storage threshold will be written there, with
+//! json keeping only the reference.
+
+void JsonItemData::set_blob_storage(BlobStorage* blob_storage)
+{
+    m_blob_storage = blob_storage;
+}
+
+//! Sets minimal number of elements in array of doubles to write it in packed form.
+//! Value -1 (default) disables packing.
+
+void JsonItemData::set_packing_threshold(int size)
+{
+    m_variant_converter->setPackingThreshold(size);
+}
+
+//! Sets the flag to compress arrays of doubles written in packed form.
+
+void JsonItemData::set_packing_compression(bool value)
+{
+    m_variant_converter->setPackingCompression(value);
+}
+
 //! Returns true if given role should be saved in json file.
 
 bool JsonItemData::role_to_save(int role) const
@@ -86,3 +147,62 @@ bool JsonItemData::role_to_save(int role) const
                         != m_roles_to_filter.end();
     return !role_in_list;
 }
+
+//! Converts variant to json. LazyData referring to the blob of current storage is written as
+//! it is, without reading, other LazyData are resolved first. When such array goes to the blob
+//! of current storage, the handle is re-pointed there, so it doesn't depend on the old location.
+
+QJsonObject JsonItemData::variant_to_json(const SessionItemData& data, const QVariant& variant)
+{
+    if (m_blob_storage && Utils::IsLazyDataVariant(variant)) {
+        auto lazy_data = variant.value<LazyData>();
+        if (auto name = m_blob_storage->adopt(lazy_data); !name.empty())
+            return blob_reference(name, lazy_data.size());
+
+        auto value = lazy_data.variant();
+        if (!is_blob_candidate(value))
+            return m_variant_converter->get_json(value);
+
+        auto result = blob_to_json(data, value);
+        lazy_data.relocate(Utils::join(m_blob_storage->dirName(), blob_name(result)), 0);
+        return result;
+    }
+
+    auto value = Utils::ResolvedVariant(variant);
+    return is_blob_candidate(value) ? blob_to_json(data, value)
+                                    : m_variant_converter->get_json(value);
+}
+
+//! Writes array into the blob storage and returns json object referring to it. Blob is
+//! identified by the identifier of the item owning the data.
+
+QJsonObject JsonItemData::blob_to_json(const SessionItemData& data, const QVariant& variant)
+{
+    const auto& values = *static_cast<const std::vector<double>*>(variant.constData());
+    auto identifier =
+        Utils::IdentifierToString(data.data(ItemDataRole::IDENTIFIER).value<identifier_type>());
+    return blob_reference(m_blob_storage->store(identifier, values), values.size());
+}
+
+QVariant JsonItemData::json_to_blob(const QJsonObject& json)
+{
+    if (!m_blob_storage)
+        throw std::runtime_error("JsonItemData::get_data() -> Error. No storage for blobs.");
+
+    auto size = static_cast<size_t>(json[variantValueKey].toObject()[blobSizeKey].toDouble());
+    return QVariant::fromValue(m_blob_storage->lazyLoad(blob_name(json), size));
+}
+
+//! Returns true if variant should be written into the blob storage.
+
+bool JsonItemData::is_blob_candidate(const QVariant& variant) const
+{
+    if (!m_blob_storage || m_blob_storage->threshold() < 0)
+        return false;
+
+    if (Utils::VariantName(variant) != Constants::vector_double_type_name)
+        return false;
+
+    const auto& values = *static_cast<const std::vector<double>*>(variant.constData());
+    return values.size() >= static_cast<size_t>(m_blob_storage->threshold());
+}
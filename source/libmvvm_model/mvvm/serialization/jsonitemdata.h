@@ -20,7 +20,8 @@ class QJsonObject;
 namespace ModelView
 {
 
-class JsonVariantInterface;
+class BlobStorage;
+class JsonVariant;
 
 //! Default converter of SessionItemData to/from json object.
 
@@ -43,10 +44,24 @@ public:
 
     bool role_to_save(int role) const;
 
+    void set_blob_storage(BlobStorage* blob_storage);
+
+    void set_packing_threshold(int size);
+
+    void set_packing_compression(bool value);
+
 private:
-    std::unique_ptr<JsonVariantInterface> m_variant_converter;
+    QJsonObject variant_to_json(const SessionItemData& data, const QVariant& variant);
+    QJsonObject blob_to_json(const SessionItemData& data, const QVariant& variant);
+    QVariant json_to_blob(const QJsonObject& json);
+    bool is_blob_candidate(const QVariant& variant) const;
+
+
+    std::unique_ptr<JsonVariant> m_variant_converter;
     //!< List of roles to filter while writing to json.
     std::vector<int> m_roles_to_filter;
+    //!< Storage for large arrays, not used if nullptr.
+    BlobStorage* m_blob_storage{nullptr};
 };
 
 } // namespace ModelView
@@ -9,11 +9,15 @@
 
 #include <QJsonArray>
 #include <QJsonObject>
+#include <mvvm/model/modelutils.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/serialization/jsonitemconverter.h>
 #include <mvvm/serialization/jsonmodelconverter.h>
+#include <mvvm/serialization/jsonstreamreader.h>
+#include <mvvm/serialization/jsonstreamwriter.h>
 #include <stdexcept>
+#include <vector>
 
 using namespace ModelView;
 
@@ -33,7 +37,12 @@ const QString ModelView::JsonModelConverter::modelKey = "model";
 const QString ModelView::JsonModelConverter::itemsKey = "items";
 const QString ModelView::JsonModelConverter::versionKey = "version";
 
-JsonModelConverter::JsonModelConverter() = default;
+JsonModelConverter::JsonModelConverter(BlobStorage* blob_storage, bool use_packed_arrays,
+                                       bool compress_packed_arrays)
+    : m_blob_storage(blob_storage), m_use_packed_arrays(use_packed_arrays),
+      m_compress_packed_arrays(compress_packed_arrays)
+{
+}
 
 JsonModelConverter::~JsonModelConverter() = default;
 
@@ -46,7 +55,9 @@ void JsonModelConverter::model_to_json(const SessionModel& model, QJsonObject& j
 
     QJsonArray itemArray;
 
-    auto converter = std::make_unique<JsonItemConverter>(model.factory());
+    auto converter = std::make_unique<JsonItemConverter>(
+        model.factory(), /*new_id_flag*/ false, m_blob_storage, m_use_packed_arrays,
+        m_compress_packed_arrays);
 
     for (auto item : model.rootItem()->children())
         itemArray.append(converter->to_json(item));
@@ -67,7 +78,9 @@ void JsonModelConverter::json_to_model(const QJsonObject& json, SessionModel& mo
                                  + model.modelType() + "', json key '"
                                  + json[modelKey].toString().toStdString() + "'");
 
-    auto converter = std::make_unique<JsonItemConverter>(model.factory());
+    auto converter = std::make_unique<JsonItemConverter>(
+        model.factory(), /*new_id_flag*/ false, m_blob_storage, m_use_packed_arrays,
+        m_compress_packed_arrays);
 
     auto rebuild_root = [&json, &converter](auto parent) {
         for (const auto ref : json[itemsKey].toArray()) {
@@ -78,6 +91,83 @@ void JsonModelConverter::json_to_model(const QJsonObject& json, SessionModel& mo
     model.clear(rebuild_root);
 }
 
+void JsonModelConverter::model_to_stream(const SessionModel& model, JsonStreamWriter& writer) const
+{
+    if (!model.rootItem())
+        throw std::runtime_error(
+            "JsonModel::model_to_stream() -> Error. Model is not initialized.");
+
+    auto converter = std::make_unique<JsonItemConverter>(
+        model.factory(), /*new_id_flag*/ false, m_blob_storage, m_use_packed_arrays,
+        m_compress_packed_arrays);
+
+    writer.beginObject();
+    writer.writeKey(modelKey);
+    writer.writeValue(QString::fromStdString(model.modelType()));
+    writer.writeKey(itemsKey);
+    writer.beginArray();
+    for (auto item : model.rootItem()->children())
+        converter->to_stream(item, writer);
+    writer.endArray();
+    writer.endObject();
+}
+
+//! Reads the model from the stream. The model is cleared only after all checks are passed.
+
+void JsonModelConverter::stream_to_model(JsonStreamReader& reader, SessionModel& model) const
+{
+    if (!model.rootItem())
+        throw std::runtime_error(
+            "JsonModel::stream_to_model() -> Error. Model is not initialized.");
+
+    Utils::PopulateModel(&model, stream_to_items(reader, model));
+}
+
+//! Reads top level items from the stream. Items are collected first, since the model type
+//! can follow them in the stream. Only constant methods of the model are used, so reading can
+//! be done in a worker thread.
+
+std::vector<std::unique_ptr<SessionItem>>
+JsonModelConverter::stream_to_items(JsonStreamReader& reader, const SessionModel& model) const
+{
+    auto converter = std::make_unique<JsonItemConverter>(
+        model.factory(), /*new_id_flag*/ false, m_blob_storage, m_use_packed_arrays,
+        m_compress_packed_arrays);
+
+    QString modelType;
+    std::vector<std::unique_ptr<SessionItem>> items;
+    bool has_model_type{false};
+    bool has_items{false};
+    bool is_valid{true};
+
+    reader.beginObject();
+    QString key;
+    while (reader.nextKey(key)) {
+        if (key == modelKey && !has_model_type) {
+            modelType = reader.readString();
+            has_model_type = true;
+        } else if (key == itemsKey && !has_items) {
+            reader.beginArray();
+            while (reader.hasNextElement())
+                items.push_back(converter->from_stream(reader));
+            has_items = true;
+        } else {
+            is_valid = false;
+            break;
+        }
+    }
+
+    if (!is_valid || !has_model_type || !has_items)
+        throw std::runtime_error("JsonModel::stream_to_items() -> Error. Invalid json object.");
+
+    if (modelType != QString::fromStdString(model.modelType()))
+        throw std::runtime_error("JsonModel::stream_to_items() -> Unexpected model type '"
+                                 + model.modelType() + "', json key '" + modelType.toStdString()
+                                 + "'");
+
+    return items;
+}
+
 bool JsonModelConverter::isSessionModel(const QJsonObject& object) const
 {
     static const QStringList expected = expected_model_keys();
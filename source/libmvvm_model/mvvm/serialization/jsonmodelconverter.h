@@ -11,14 +11,20 @@
 #define MVVM_SERIALIZATION_JSONMODELCONVERTER_H
 
 #include <QString>
+#include <memory>
 #include <mvvm/serialization/jsonconverterinterfaces.h>
+#include <vector>
 
 class QJsonObject;
 
 namespace ModelView
 {
 
+class BlobStorage;
+class SessionItem;
 class SessionModel;
+class JsonStreamReader;
+class JsonStreamWriter;
 
 class MVVM_MODEL_EXPORT JsonModelConverter : public JsonModelConverterInterface
 {
@@ -27,7 +33,9 @@ public:
     static const QString itemsKey;
     static const QString versionKey;
 
-    JsonModelConverter();
+    explicit JsonModelConverter(BlobStorage* blob_storage = nullptr,
+                                bool use_packed_arrays = false,
+                                bool compress_packed_arrays = false);
     ~JsonModelConverter() override;
 
     //! Writes content of model into json.
@@ -36,8 +44,23 @@ public:
     //! Reads json object and build the model.
     void json_to_model(const QJsonObject& json, SessionModel& model) const override;
 
+    //! Writes content of model directly into the stream.
+    void model_to_stream(const SessionModel& model, JsonStreamWriter& writer) const;
+
+    //! Reads the stream and builds the model.
+    void stream_to_model(JsonStreamReader& reader, SessionModel& model) const;
+
+    //! Reads top level items of the model from the stream, the model itself is not changed.
+    std::vector<std::unique_ptr<SessionItem>> stream_to_items(JsonStreamReader& reader,
+                                                              const SessionModel& model) const;
+
     //! Returns true if given json object represents SessionModel.
     bool isSessionModel(const QJsonObject& object) const;
+
+private:
+    BlobStorage* m_blob_storage{nullptr}; //! storage for large arrays, not used if nullptr
+    bool m_use_packed_arrays{false};      //! write large arrays of doubles in packed form
+    bool m_compress_packed_arrays{false}; //! compress arrays written in packed form
 };
 
 } // namespace ModelView
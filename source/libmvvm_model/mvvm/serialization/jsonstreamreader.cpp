@@ -0,0 +1,318 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QIODevice>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+#include <mvvm/serialization/jsonstreamreader.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace
+{
+bool is_whitespace(char ch)
+{
+    return ch == ' ' || ch == '\n' || ch == '\r' || ch == '\t';
+}
+
+bool is_number_char(char ch)
+{
+    return (ch >= '0' && ch <= '9') || ch == '-' || ch == '+' || ch == '.' || ch == 'e'
+           || ch == 'E';
+}
+
+int hex_value(char ch)
+{
+    if (ch >= '0' && ch <= '9')
+        return ch - '0';
+    if (ch >= 'a' && ch <= 'f')
+        return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F')
+        return ch - 'A' + 10;
+    return -1;
+}
+
+} // namespace
+
+JsonStreamReader::JsonStreamReader(QIODevice* device, int chunk_size)
+    : m_device(device), m_chunk_size(chunk_size)
+{
+    if (m_chunk_size <= 0)
+        throw std::runtime_error(
+            "JsonStreamReader::JsonStreamReader() -> Error. Wrong chunk size.");
+}
+
+void JsonStreamReader::beginObject()
+{
+    skip_whitespace();
+    expect('{');
+    m_is_first.push_back(true);
+}
+
+//! Reads the key of the next value in the current object. Returns false if the object
+//! has ended, the closing bracket is consumed in that case.
+
+bool JsonStreamReader::nextKey(QString& key)
+{
+    if (!begin_element('}'))
+        return false;
+
+    key = readString();
+    skip_whitespace();
+    expect(':');
+    return true;
+}
+
+void JsonStreamReader::beginArray()
+{
+    skip_whitespace();
+    expect('[');
+    m_is_first.push_back(true);
+}
+
+//! Returns true if the current array has one more element. Returns false if the array
+//! has ended, the closing bracket is consumed in that case.
+
+bool JsonStreamReader::hasNextElement()
+{
+    return begin_element(']');
+}
+
+QString JsonStreamReader::readString()
+{
+    skip_whitespace();
+    expect('"');
+
+    QByteArray result;
+    for (;;) {
+        char ch = get();
+        if (ch == '"')
+            break;
+        if (static_cast<unsigned char>(ch) < 0x20)
+            throw_error("Control character in string");
+        if (ch != '\\') {
+            result.append(ch);
+            continue;
+        }
+
+        ch = get();
+        switch (ch) {
+        case '"':
+        case '\\':
+        case '/':
+            result.append(ch);
+            break;
+        case 'b':
+            result.append('\b');
+            break;
+        case 'f':
+            result.append('\f');
+            break;
+        case 'n':
+            result.append('\n');
+            break;
+        case 'r':
+            result.append('\r');
+            break;
+        case 't':
+            result.append('\t');
+            break;
+        case 'u': {
+            // surrogate pairs come as two consecutive escape sequences
+            QString utf16;
+            for (;;) {
+                uint code{0};
+                for (int i = 0; i < 4; ++i) {
+                    int value = hex_value(get());
+                    if (value < 0)
+                        throw_error("Invalid unicode escape sequence");
+                    code = code * 16 + static_cast<uint>(value);
+                }
+                utf16.append(QChar(static_cast<ushort>(code)));
+                if (!QChar::isHighSurrogate(code) || peek() != '\\')
+                    break;
+                get();
+                if (get() != 'u')
+                    throw_error("Invalid unicode escape sequence");
+            }
+            result.append(utf16.toUtf8());
+            break;
+        }
+        default:
+            throw_error("Invalid escape sequence");
+        }
+    }
+
+    return QString::fromUtf8(result);
+}
+
+//! Reads complete value at the current position.
+
+QJsonValue JsonStreamReader::readValue()
+{
+    skip_whitespace();
+    switch (peek()) {
+    case '{': {
+        QJsonObject result;
+        beginObject();
+        QString key;
+        while (nextKey(key))
+            result.insert(key, readValue());
+        return result;
+    }
+    case '[': {
+        QJsonArray result;
+        beginArray();
+        while (hasNextElement())
+            result.append(readValue());
+        return result;
+    }
+    case '"':
+        return readString();
+    case 't':
+        expect_literal("true");
+        return true;
+    case 'f':
+        expect_literal("false");
+        return false;
+    case 'n':
+        expect_literal("null");
+        return QJsonValue();
+    default: {
+        bool ok{false};
+        double value = read_number().toDouble(&ok);
+        if (!ok)
+            throw_error("Invalid number");
+        return value;
+    }
+    }
+}
+
+//! Skips value at the current position without building it.
+
+void JsonStreamReader::skipValue()
+{
+    skip_whitespace();
+    switch (peek()) {
+    case '{': {
+        beginObject();
+        QString key;
+        while (nextKey(key))
+            skipValue();
+        break;
+    }
+    case '[':
+        beginArray();
+        while (hasNextElement())
+            skipValue();
+        break;
+    case '"':
+        readString();
+        break;
+    default:
+        readValue();
+    }
+}
+
+//! Returns true if there is nothing but whitespace left in the device.
+
+bool JsonStreamReader::atEnd()
+{
+    skip_whitespace();
+    return m_pos >= m_buffer.size() && !fill_buffer();
+}
+
+//! Consumes separator between elements of the current object or array. Returns false
+//! if closing bracket was found instead.
+
+bool JsonStreamReader::begin_element(char closing)
+{
+    if (m_is_first.empty())
+        throw_error("No open object or array");
+
+    skip_whitespace();
+    if (peek() == closing) {
+        get();
+        m_is_first.pop_back();
+        return false;
+    }
+
+    if (m_is_first.back())
+        m_is_first.back() = false;
+    else
+        expect(',');
+
+    skip_whitespace();
+    return true;
+}
+
+char JsonStreamReader::peek()
+{
+    if (m_pos >= m_buffer.size() && !fill_buffer())
+        throw_error("Unexpected end of data");
+    return m_buffer.at(m_pos);
+}
+
+char JsonStreamReader::get()
+{
+    char result = peek();
+    ++m_pos;
+    return result;
+}
+
+void JsonStreamReader::expect(char ch)
+{
+    if (get() != ch)
+        throw_error(std::string("Expected '") + ch + "'");
+}
+
+void JsonStreamReader::skip_whitespace()
+{
+    for (;;) {
+        if (m_pos >= m_buffer.size() && !fill_buffer())
+            return;
+        if (!is_whitespace(m_buffer.at(m_pos)))
+            return;
+        ++m_pos;
+    }
+}
+
+void JsonStreamReader::expect_literal(const char* literal)
+{
+    for (const char* ch = literal; *ch; ++ch)
+        expect(*ch);
+}
+
+QByteArray JsonStreamReader::read_number()
+{
+    QByteArray result;
+    while ((m_pos < m_buffer.size() || fill_buffer()) && is_number_char(m_buffer.at(m_pos)))
+        result.append(m_buffer.at(m_pos++));
+    return result;
+}
+
+//! Replaces consumed buffer with the next chunk from the device. Returns false if no more
+//! data available.
+
+bool JsonStreamReader::fill_buffer()
+{
+    m_consumed += m_buffer.size();
+    m_buffer = m_device->read(m_chunk_size);
+    m_pos = 0;
+    return !m_buffer.isEmpty();
+}
+
+void JsonStreamReader::throw_error(const std::string& message) const
+{
+    throw std::runtime_error("JsonStreamReader -> Error. " + message + " at position "
+                             + std::to_string(m_consumed + m_pos) + ".");
+}
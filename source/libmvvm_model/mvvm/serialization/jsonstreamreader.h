@@ -0,0 +1,74 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_JSONSTREAMREADER_H
+#define MVVM_SERIALIZATION_JSONSTREAMREADER_H
+
+#include <QByteArray>
+#include <mvvm/model_export.h>
+#include <string>
+#include <vector>
+
+class QIODevice;
+class QJsonValue;
+class QString;
+
+namespace ModelView
+{
+
+/*!
+@class JsonStreamReader
+@brief Pull parser of json text which reads the device in chunks of fixed size.
+
+Caller walks through the document with beginObject/nextKey and beginArray/hasNextElement,
+while small values are read in the form of json values. This allows to build the content
+directly from the stream without intermediate json document.
+*/
+
+class MVVM_MODEL_EXPORT JsonStreamReader
+{
+public:
+    static const int defaultChunkSize = 65536;
+
+    explicit JsonStreamReader(QIODevice* device, int chunk_size = defaultChunkSize);
+
+    void beginObject();
+    bool nextKey(QString& key);
+
+    void beginArray();
+    bool hasNextElement();
+
+    QString readString();
+    QJsonValue readValue();
+    void skipValue();
+
+    bool atEnd();
+
+private:
+    bool begin_element(char closing);
+    char peek();
+    char get();
+    void expect(char ch);
+    void skip_whitespace();
+    void expect_literal(const char* literal);
+    QByteArray read_number();
+    bool fill_buffer();
+    [[noreturn]] void throw_error(const std::string& message) const;
+
+    QIODevice* m_device{nullptr};
+    int m_chunk_size{0};
+    QByteArray m_buffer;
+    int m_pos{0};            //! current position in the buffer
+    qint64 m_consumed{0};    //! number of bytes consumed before current buffer
+    std::vector<bool> m_is_first; //! state of open objects and arrays, true if no elements yet
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_JSONSTREAMREADER_H
@@ -0,0 +1,179 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include <QByteArray>
+#include <QIODevice>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QLocale>
+#include <cmath>
+#include <mvvm/serialization/jsonstreamwriter.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace
+{
+QByteArray escaped_string(const QString& str);
+QByteArray number_to_json(double value);
+} // namespace
+
+JsonStreamWriter::JsonStreamWriter(QIODevice* device) : m_device(device) {}
+
+void JsonStreamWriter::beginObject()
+{
+    begin_element();
+    write("{");
+    m_is_first.push_back(true);
+}
+
+void JsonStreamWriter::endObject()
+{
+    if (m_is_first.empty())
+        throw std::runtime_error("JsonStreamWriter::endObject() -> Error. No open object.");
+    m_is_first.pop_back();
+    write("}");
+}
+
+void JsonStreamWriter::beginArray()
+{
+    begin_element();
+    write("[");
+    m_is_first.push_back(true);
+}
+
+void JsonStreamWriter::endArray()
+{
+    if (m_is_first.empty())
+        throw std::runtime_error("JsonStreamWriter::endArray() -> Error. No open array.");
+    m_is_first.pop_back();
+    write("]");
+}
+
+//! Writes the key of the next value in the current object.
+
+void JsonStreamWriter::writeKey(const QString& key)
+{
+    begin_element();
+    write(escaped_string(key));
+    write(":");
+    m_after_key = true;
+}
+
+//! Writes complete value: either scalar, or small json object/array.
+
+void JsonStreamWriter::writeValue(const QJsonValue& value)
+{
+    begin_element();
+
+    switch (value.type()) {
+    case QJsonValue::Object:
+        write(QJsonDocument(value.toObject()).toJson(QJsonDocument::Compact));
+        break;
+    case QJsonValue::Array:
+        write(QJsonDocument(value.toArray()).toJson(QJsonDocument::Compact));
+        break;
+    case QJsonValue::String:
+        write(escaped_string(value.toString()));
+        break;
+    case QJsonValue::Double:
+        write(number_to_json(value.toDouble()));
+        break;
+    case QJsonValue::Bool:
+        write(value.toBool() ? "true" : "false");
+        break;
+    default:
+        write("null");
+    }
+}
+
+//! Writes separator between elements of the current object or array, if necessary.
+
+void JsonStreamWriter::begin_element()
+{
+    if (m_after_key) {
+        m_after_key = false;
+        return;
+    }
+
+    if (!m_is_first.empty()) {
+        if (!m_is_first.back())
+            write(",");
+        m_is_first.back() = false;
+    }
+}
+
+void JsonStreamWriter::write(const QByteArray& data)
+{
+    if (m_device->write(data) != data.size())
+        throw std::runtime_error("JsonStreamWriter -> Error. Can't write to the device.");
+}
+
+namespace
+{
+
+//! Returns string in quotes with json escape sequences.
+
+QByteArray escaped_string(const QString& str)
+{
+    const QByteArray utf8 = str.toUtf8();
+    QByteArray result;
+    result.reserve(utf8.size() + 2);
+    result.append('"');
+    for (char ch : utf8) {
+        switch (ch) {
+        case '"':
+            result.append("\\\"");
+            break;
+        case '\\':
+            result.append("\\\\");
+            break;
+        case '\b':
+            result.append("\\b");
+            break;
+        case '\f':
+            result.append("\\f");
+            break;
+        case '\n':
+            result.append("\\n");
+            break;
+        case '\r':
+            result.append("\\r");
+            break;
+        case '\t':
+            result.append("\\t");
+            break;
+        default:
+            if (static_cast<unsigned char>(ch) < 0x20)
+                result.append("\\u00").append(QByteArray::number(ch, 16).rightJustified(2, '0'));
+            else
+                result.append(ch);
+        }
+    }
+    result.append('"');
+    return result;
+}
+
+//! Returns shortest representation of the number which reads back exactly, as QJsonDocument does.
+
+QByteArray number_to_json(double value)
+{
+    if (!std::isfinite(value))
+        return "null";
+
+    // integers are written without exponent and decimal point
+    if (std::abs(value) < 9007199254740992.0 && value == std::floor(value))
+        return QByteArray::number(static_cast<qint64>(value));
+
+    return QByteArray::number(value, 'g', QLocale::FloatingPointShortest);
+}
+
+} // namespace
@@ -0,0 +1,58 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_JSONSTREAMWRITER_H
+#define MVVM_SERIALIZATION_JSONSTREAMWRITER_H
+
+#include <mvvm/model_export.h>
+#include <vector>
+
+class QIODevice;
+class QJsonValue;
+class QString;
+class QByteArray;
+
+namespace ModelView
+{
+
+/*!
+@class JsonStreamWriter
+@brief Writes compact json text directly into the device while the content is visited.
+
+Only small values (i.e. item data of a single item) are converted to json objects before
+writing, so the memory consumption doesn't depend on the size of the whole document.
+*/
+
+class MVVM_MODEL_EXPORT JsonStreamWriter
+{
+public:
+    explicit JsonStreamWriter(QIODevice* device);
+
+    void beginObject();
+    void endObject();
+
+    void beginArray();
+    void endArray();
+
+    void writeKey(const QString& key);
+
+    void writeValue(const QJsonValue& value);
+
+private:
+    void begin_element();
+    void write(const QByteArray& data);
+
+    QIODevice* m_device{nullptr};
+    std::vector<bool> m_is_first; //! state of open objects and arrays, true if no elements yet
+    bool m_after_key{false};      //! the key was written, value is expected
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_JSONSTREAMWRITER_H
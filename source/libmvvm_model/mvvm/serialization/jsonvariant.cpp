@@ -7,8 +7,13 @@
 //
 // ************************************************************************** //
 
+#include <QByteArray>
 #include <QJsonArray>
 #include <QJsonObject>
+#include <QtEndian>
+#include <cmath>
+#include <limits>
+#include <mvvm/core/uniqueid.h>
 #include <mvvm/model/comboproperty.h>
 #include <mvvm/model/customvariants.h>
 #include <mvvm/model/externalproperty.h>
@@ -33,6 +38,14 @@ const QString extPropertyIdKey = "identifier";
 const QString realLimitsTextKey = "text";
 const QString realLimitsMinKey = "min";
 const QString realLimitsMaxKey = "max";
+const QString packedEncodingKey = "encoding";
+const QString packedSizeKey = "size";
+const QString packedDataKey = "data";
+const QString base64_encoding = "base64";
+const QString zlib_base64_encoding = "zlib+base64";
+
+//! Type name of packed std::vector<double>, used in json only.
+const std::string packed_vector_double_type_name = "std::vector<double>:packed";
 
 QStringList expected_variant_keys();
 
@@ -54,6 +67,9 @@ QVariant to_double(const QJsonObject& object);
 QJsonObject from_vector_double(const QVariant& variant);
 QVariant to_vector_double(const QJsonObject& object);
 
+QJsonObject from_packed_vector_double(const QVariant& variant, bool compress);
+QVariant to_packed_vector_double(const QJsonObject& object);
+
 QJsonObject from_comboproperty(const QVariant& variant);
 QVariant to_comboproperty(const QJsonObject& object);
 
@@ -75,15 +91,29 @@ JsonVariant::JsonVariant()
     m_converters[Constants::int_type_name] = {from_int, to_int};
     m_converters[Constants::string_type_name] = {from_string, to_string};
     m_converters[Constants::double_type_name] = {from_double, to_double};
-    m_converters[Constants::vector_double_type_name] = {from_vector_double, to_vector_double};
+    auto vector_double_to_json = [this](const QVariant& variant) {
+        const auto& data = *static_cast<const std::vector<double>*>(variant.constData());
+        if (m_packing_threshold >= 0 && data.size() >= static_cast<size_t>(m_packing_threshold))
+            return from_packed_vector_double(variant, m_packing_compression);
+        return from_vector_double(variant);
+    };
+    m_converters[Constants::vector_double_type_name] = {vector_double_to_json, to_vector_double};
+    m_converters[packed_vector_double_type_name] = {vector_double_to_json,
+                                                    to_packed_vector_double};
     m_converters[Constants::comboproperty_type_name] = {from_comboproperty, to_comboproperty};
     m_converters[Constants::qcolor_type_name] = {from_qcolor, to_qcolor};
     m_converters[Constants::extproperty_type_name] = {from_extproperty, to_extproperty};
     m_converters[Constants::reallimits_type_name] = {from_reallimits, to_reallimits};
 }
 
+//! Returns json object representing given variant. UniqueId is written in its textual form, so
+//! json doesn't depend on identifier_type the library was built with.
+
 QJsonObject JsonVariant::get_json(const QVariant& variant)
 {
+    if (Utils::IsUniqueIdVariant(variant))
+        return get_json(QVariant::fromValue(variant.value<UniqueId>().toString()));
+
     const std::string type_name = Utils::VariantName(variant);
 
     if (m_converters.find(type_name) == m_converters.end())
@@ -106,6 +136,21 @@ QVariant JsonVariant::get_variant(const QJsonObject& object)
     return m_converters[type_name].json_to_variant(object);
 }
 
+//! Sets minimal number of elements in array of doubles to write it in packed form.
+//! Value -1 disables packing, value 0 makes all arrays packed.
+
+void JsonVariant::setPackingThreshold(int size)
+{
+    m_packing_threshold = size;
+}
+
+//! Sets the flag to compress packed arrays of doubles.
+
+void JsonVariant::setPackingCompression(bool value)
+{
+    m_packing_compression = value;
+}
+
 //! Returns true if given json object represents variant.
 
 bool JsonVariant::isVariant(const QJsonObject& object) const
@@ -214,6 +259,62 @@ QVariant to_vector_double(const QJsonObject& object)
     return QVariant::fromValue(vec);
 }
 
+//! Writes array as base64 of little-endian IEEE doubles, optionally compressed.
+
+QJsonObject from_packed_vector_double(const QVariant& variant, bool compress)
+{
+    const auto& data = *static_cast<const std::vector<double>*>(variant.constData());
+
+    // base64 text takes 4 characters per 3 bytes and should fit into QString
+    const size_t max_byte_count = std::numeric_limits<int>::max() / 4 * 3;
+    if (data.size() > max_byte_count / sizeof(double))
+        throw std::runtime_error("json::get_json() -> Error. Array is too large to be packed.");
+
+    QByteArray bytes(static_cast<int>(data.size() * sizeof(double)), Qt::Uninitialized);
+    qToLittleEndian<quint64>(data.data(), static_cast<qsizetype>(data.size()), bytes.data());
+    if (compress)
+        bytes = qCompress(bytes);
+
+    QJsonObject json_data;
+    json_data[packedEncodingKey] = compress ? zlib_base64_encoding : base64_encoding;
+    json_data[packedSizeKey] = static_cast<double>(data.size());
+    json_data[packedDataKey] = QString::fromLatin1(bytes.toBase64());
+
+    QJsonObject result;
+    result[variantTypeKey] = QString::fromStdString(packed_vector_double_type_name);
+    result[variantValueKey] = json_data;
+    return result;
+}
+
+QVariant to_packed_vector_double(const QJsonObject& object)
+{
+    QJsonObject json_data = object[variantValueKey].toObject();
+    const auto encoding = json_data[packedEncodingKey].toString();
+
+    // size is checked before the conversion, since casting out-of-range double is undefined
+    const auto json_size = json_data.value(packedSizeKey);
+    const double max_size = std::numeric_limits<int>::max() / sizeof(double);
+    if (!json_size.isDouble() || !std::isfinite(json_size.toDouble())
+        || json_size.toDouble() < 0 || json_size.toDouble() > max_size
+        || std::floor(json_size.toDouble()) != json_size.toDouble())
+        throw std::runtime_error("json::get_variant() -> Error. Corrupted packed array.");
+    const auto size = static_cast<size_t>(json_size.toDouble());
+
+    auto bytes = QByteArray::fromBase64(json_data[packedDataKey].toString().toLatin1());
+    if (encoding == zlib_base64_encoding)
+        bytes = qUncompress(bytes);
+    else if (encoding != base64_encoding)
+        throw std::runtime_error("json::get_variant() -> Error. Unknown encoding '"
+                                 + encoding.toStdString() + "' of packed array.");
+
+    if (static_cast<size_t>(bytes.size()) != size * sizeof(double))
+        throw std::runtime_error("json::get_variant() -> Error. Corrupted packed array.");
+
+    std::vector<double> vec(size);
+    qFromLittleEndian<quint64>(bytes.constData(), static_cast<qsizetype>(size), vec.data());
+    return QVariant::fromValue(vec);
+}
+
 // --- ComboProperty ------
 
 QJsonObject from_comboproperty(const QVariant& variant)
@@ -20,10 +20,20 @@ class QJsonVariant;
 namespace ModelView
 {
 
+//! Default converter between QVariant and json object.
+//! Arrays of doubles can be written in packed form: base64 of little-endian IEEE doubles,
+//! optionally compressed. Packing is disabled by default, both packed and plain forms are
+//! accepted on reading.
+
 class MVVM_MODEL_EXPORT JsonVariant : public JsonVariantInterface
 {
 public:
+    //! Packing threshold used by documents with packed arrays.
+    static const int defaultPackingThreshold = 1024;
+
     JsonVariant();
+    JsonVariant(const JsonVariant& other) = delete;
+    JsonVariant& operator=(const JsonVariant& other) = delete;
 
     QJsonObject get_json(const QVariant& variant) override;
 
@@ -31,6 +41,10 @@ public:
 
     bool isVariant(const QJsonObject& object) const;
 
+    void setPackingThreshold(int size);
+
+    void setPackingCompression(bool value);
+
 private:
     struct Converters {
         std::function<QJsonObject(const QVariant& variant)> variant_to_json;
@@ -38,6 +52,8 @@ private:
     };
 
     std::map<std::string, Converters> m_converters;
+    int m_packing_threshold{-1};       //! min size of array to pack, -1 to disable
+    bool m_packing_compression{false}; //! compress packed arrays
 };
 
 } // namespace ModelView
@@ -11,10 +11,12 @@
 #define MVVM_SIGNALS_CALLBACKCONTAINER_H
 
 #include <algorithm>
+#include <deque>
 #include <functional>
-#include <list>
 #include <mvvm/model_export.h>
 #include <mvvm/signals/callback_types.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ModelView
 {
@@ -23,6 +25,12 @@ class SessionItem;
 class SessionModel;
 
 //! Container to hold callbacks in the context of ModelMapper.
+//!
+//! Callbacks are stored in slots in order of connection, with an index from the client to its
+//! slots. Removal of the client marks its slots as dead, dead slots are compacted away when
+//! they start to dominate. Clients are allowed to connect and disconnect while notification is
+//! running: slots never move during notification, dead slots are skipped, new slots are notified
+//! too.
 
 template <typename T, typename U> class SignalBase
 {
@@ -36,12 +44,31 @@ public:
     void remove_client(U client);
 
 private:
-    std::list<std::pair<T, U>> m_callbacks;
+    struct Slot {
+        T m_callback;
+        U m_client;
+        bool m_alive;
+    };
+
+    //! Keeps notification depth counter correct even if callback throws.
+    struct NotifyDepthGuard {
+        int& m_depth;
+        explicit NotifyDepthGuard(int& depth) : m_depth(depth) { ++m_depth; }
+        ~NotifyDepthGuard() { --m_depth; }
+    };
+
+    void compact();
+
+    std::deque<Slot> m_slots; //! deque, to keep slots in place when connecting during notification
+    std::unordered_map<U, std::vector<size_t>> m_client_slots; //! client -> slot indices
+    size_t m_dead_count{0};
+    int m_notify_depth{0};
 };
 
 template <typename T, typename U> void SignalBase<T, U>::connect(T callback, U client)
 {
-    m_callbacks.push_back(std::make_pair(callback, client));
+    m_client_slots[client].push_back(m_slots.size());
+    m_slots.push_back(Slot{std::move(callback), client, true});
 }
 
 //! Notify clients using given list of arguments.
@@ -49,17 +76,48 @@ template <typename T, typename U>
 template <typename... Args>
 void SignalBase<T, U>::operator()(Args... args)
 {
-    for (const auto& f : m_callbacks) {
-        f.first(args...);
+    {
+        NotifyDepthGuard guard(m_notify_depth);
+        for (size_t index = 0; index < m_slots.size(); ++index) {
+            if (m_slots[index].m_alive)
+                m_slots[index].m_callback(args...);
+        }
     }
+
+    compact();
 }
 
 //! Remove client from the list to call back.
 
 template <typename T, typename U> void SignalBase<T, U>::remove_client(U client)
 {
-    m_callbacks.remove_if(
-        [client](const std::pair<T, U>& x) -> bool { return (x.second == client ? true : false); });
+    auto it = m_client_slots.find(client);
+    if (it == m_client_slots.end())
+        return;
+
+    for (auto index : it->second)
+        m_slots[index].m_alive = false;
+    m_dead_count += it->second.size();
+    m_client_slots.erase(it);
+
+    compact();
+}
+
+//! Removes dead slots if they make up more than half of all slots, and notification isn't running.
+
+template <typename T, typename U> void SignalBase<T, U>::compact()
+{
+    if (m_notify_depth > 0 || m_dead_count * 2 <= m_slots.size())
+        return;
+
+    m_slots.erase(std::remove_if(m_slots.begin(), m_slots.end(),
+                                 [](const Slot& slot) { return !slot.m_alive; }),
+                  m_slots.end());
+    m_dead_count = 0;
+
+    m_client_slots.clear();
+    for (size_t index = 0; index < m_slots.size(); ++index)
+        m_client_slots[m_slots[index].m_client].push_back(index);
 }
 
 //! Callback container for specific client type.
@@ -133,12 +133,11 @@ void ItemMapper::unsubscribe(Callbacks::slot_t client)
     m_on_about_to_remove_item.remove_client(client);
 }
 
-//! Processes signals from the model when item data changed.
+//! Processes signals from the model when item data changed. Parameter 'nestling' is the distance
+//! from our item to the changed item (0 - item itself, 1 - its property, 2 - child's property).
 
-void ItemMapper::processDataChange(SessionItem* item, int role)
+void ItemMapper::processDataChange(SessionItem* item, int role, int nestling)
 {
-    int nestling = nestlingDepth(item);
-
     // own item data changed
     if (nestling == 0)
         callOnDataChange(item, role);
@@ -172,45 +171,18 @@ void ItemMapper::processAboutToRemoveItem(SessionItem* parent, TagRow tagrow)
         callOnAboutToRemoveItem(m_item, tagrow);
 }
 
-//! Subscribes to model signals.
+//! Registers in model's mapper to receive signals related to our item.
 
 void ItemMapper::subscribe_to_model()
 {
-    auto on_data_change = [this](ModelView::SessionItem* item, int role) {
-        processDataChange(item, role);
-    };
-    m_model->mapper()->setOnDataChange(on_data_change, this);
-
-    auto on_item_inserted = [this](ModelView::SessionItem* item, TagRow tagrow) {
-        processItemInserted(item, tagrow);
-    };
-    m_model->mapper()->setOnItemInserted(on_item_inserted, this);
-
-    auto on_item_removed = [this](ModelView::SessionItem* item, TagRow tagrow) {
-        processItemRemoved(item, tagrow);
-    };
-    m_model->mapper()->setOnItemRemoved(on_item_removed, this);
-
-    auto on_about_to_remove_item = [this](ModelView::SessionItem* item, ModelView::TagRow tagrow) {
-        processAboutToRemoveItem(item, tagrow);
-    };
-    m_model->mapper()->setOnAboutToRemoveItem(on_about_to_remove_item, this);
+    m_model->mapper()->registerItemMapper(m_item, this);
 }
 
-//! Unsubscribes from model signals.
+//! Unregisters from model's mapper.
 
 void ItemMapper::unsubscribe_from_model()
 {
-    m_model->mapper()->unsubscribe(this);
-}
-
-int ItemMapper::nestlingDepth(SessionItem* item, int level)
-{
-    if (item == nullptr || item == m_model->rootItem())
-        return -1;
-    if (item == m_item)
-        return level;
-    return nestlingDepth(item->parent(), level + 1);
+    m_model->mapper()->unregisterItemMapper(m_item);
 }
 
 //! Calls all callbacks subscribed to "item is destroyed" event.
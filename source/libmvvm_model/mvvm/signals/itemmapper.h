@@ -20,13 +20,14 @@ class SessionModel;
 
 //! Provides notifications on varios changes for specific item.
 //!
-//! ItemMapper listens signals coming from the model (i.e. via ModelMapper) and processes only whose
-//! signals which are related to given item. Notifies all interested subscribers about things
-//! going with given item and its relatives.
+//! ItemMapper is registered in the model's ModelMapper, which forwards to it only signals related
+//! to given item and its relatives. Notifies all interested subscribers about things going with
+//! given item and its relatives.
 
 class MVVM_MODEL_EXPORT ItemMapper
 {
     friend class SessionItem;
+    friend class ModelMapper;
 
 public:
     ItemMapper(SessionItem* item);
@@ -47,13 +48,12 @@ public:
     void unsubscribe(Callbacks::slot_t client);
 
 private:
-    void processDataChange(SessionItem* item, int role);
+    void processDataChange(SessionItem* item, int role, int nestling);
     void processItemInserted(SessionItem* parent, TagRow tagrow);
     void processItemRemoved(SessionItem* parent, TagRow tagrow);
     void processAboutToRemoveItem(SessionItem* parent, TagRow tagrow);
     void subscribe_to_model();
     void unsubscribe_from_model();
-    int nestlingDepth(SessionItem* item, int level = 0);
 
     void callOnItemDestroy();
     void callOnDataChange(SessionItem* item, int role);
@@ -7,8 +7,18 @@
 //
 // ************************************************************************** //
 
+#include <algorithm>
+#include <array>
+#include <mvvm/model/itemutils.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
 #include <mvvm/signals/callbackcontainer.h>
+#include <mvvm/signals/itemmapper.h>
 #include <mvvm/signals/modelmapper.h>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 using namespace ModelView;
 
@@ -23,9 +33,130 @@ struct ModelMapper::ModelMapperImpl {
 
     bool m_active{true};
     SessionModel* m_model{nullptr};
+    std::unordered_map<const SessionItem*, ItemMapper*> m_item_mappers;
+
+    int m_batch_depth{0};
+    std::vector<SessionItem*> m_pending_items;             //! items with data changed, in order
+    std::unordered_set<const SessionItem*> m_listed_items; //! items present in m_pending_items
+    std::unordered_map<const SessionItem*, std::vector<int>> m_pending_roles;
+    //! pending changes of items taken from the model during the batch, never dereferenced
+    std::unordered_map<const SessionItem*, std::vector<int>> m_detached_roles;
 
     ModelMapperImpl(SessionModel* model) : m_model(model){};
 
+    //! Returns mapper registered for given item, or nullptr.
+    ItemMapper* item_mapper(const SessionItem* item) const
+    {
+        if (m_item_mappers.empty())
+            return nullptr;
+        auto it = m_item_mappers.find(item);
+        return it == m_item_mappers.end() ? nullptr : it->second;
+    }
+
+    //! Remembers data change of given item to notify about it at the end of the batch.
+    void add_pending_data_change(SessionItem* item, int role)
+    {
+        auto [it, is_new_item] = m_pending_roles.try_emplace(item);
+        if (is_new_item)
+            list_pending_item(item);
+        if (std::find(it->second.begin(), it->second.end(), role) == it->second.end())
+            it->second.push_back(role);
+    }
+
+    //! Puts aside pending data changes of the item and all its descendants, since they are
+    //! leaving the model and might be deleted before the end of the batch.
+    void detach_pending_data_change(SessionItem* item)
+    {
+        if (m_pending_roles.empty() || !item)
+            return;
+        Utils::iterate(item, [this](SessionItem* child) {
+            if (auto it = m_pending_roles.find(child); it != m_pending_roles.end()) {
+                m_detached_roles[child] = std::move(it->second);
+                m_pending_roles.erase(it);
+            }
+        });
+    }
+
+    //! Restores pending data changes of the item and its descendants, which were put aside when
+    //! the item was taken from the model (i.e. the item is moved).
+    void attach_pending_data_change(SessionItem* item)
+    {
+        if (m_detached_roles.empty() || !item)
+            return;
+        Utils::iterate(item, [this](SessionItem* child) {
+            if (auto it = m_detached_roles.find(child); it != m_detached_roles.end()) {
+                m_pending_roles[child] = std::move(it->second);
+                m_detached_roles.erase(it);
+                list_pending_item(child);
+            }
+        });
+    }
+
+    //! Adds item to the ordered list of pending items, if it isn't there yet.
+    void list_pending_item(SessionItem* item)
+    {
+        if (m_listed_items.insert(item).second)
+            m_pending_items.push_back(item);
+    }
+
+    void clear_pending()
+    {
+        m_pending_items.clear();
+        m_listed_items.clear();
+        m_pending_roles.clear();
+        m_detached_roles.clear();
+    }
+
+    //! Emits single data change notification for every (item, role) changed during the batch.
+    //! Pending changes are kept in the map until emitted, so items removed by callbacks during
+    //! the flush are still dropped. Changes of items which are still out of the model are
+    //! forgotten.
+    void flush_pending()
+    {
+        auto items = std::move(m_pending_items);
+        m_pending_items.clear();
+        m_listed_items.clear();
+        m_detached_roles.clear();
+
+        for (auto item : items) {
+            auto it = m_pending_roles.find(item);
+            if (it == m_pending_roles.end())
+                continue;
+            auto roles = std::move(it->second);
+            m_pending_roles.erase(it);
+            for (auto role : roles) {
+                m_on_data_change(item, role);
+                process_data_change(item, role);
+            }
+        }
+    }
+
+    //! Notifies mappers of the item, its parent and grandparent about item's data change.
+    //! Ancestors are collected beforehand, since callbacks are allowed to modify the model.
+    void process_data_change(SessionItem* item, int role)
+    {
+        if (m_item_mappers.empty())
+            return;
+
+        const int max_nestling = 3; // item itself, its parent and grandparent
+        std::array<SessionItem*, max_nestling> ancestors{};
+        auto current = item;
+        for (int nestling = 0; nestling < max_nestling; ++nestling) {
+            if (!current || current == m_model->rootItem())
+                break;
+            ancestors[static_cast<size_t>(nestling)] = current;
+            current = current->parent();
+        }
+
+        for (int nestling = 0; nestling < max_nestling; ++nestling) {
+            auto ancestor = ancestors[static_cast<size_t>(nestling)];
+            if (!ancestor)
+                break;
+            if (auto mapper = item_mapper(ancestor); mapper)
+                mapper->processDataChange(item, role, nestling);
+        }
+    }
+
     void unsubscribe(Callbacks::slot_t client)
     {
         m_on_data_change.remove_client(client);
@@ -102,6 +233,53 @@ void ModelMapper::setActive(bool value)
     p_impl->m_active = value;
 }
 
+/*!
+@brief Starts notification batch.
+
+Until the matching endBatch() call, data change notifications are collected instead of being
+emitted. At the end of the batch, a single notification is emitted for every (item, role) pair
+changed, in order of first change. Notifications about items which have left the model during the
+batch are dropped, unless the item was inserted back (i.e. moved). Structural notifications
+(insert, remove) are emitted immediately, since listeners (i.e. view models) have to follow the
+layout of the model step by step.
+Batches can be nested, notifications are emitted when the outermost batch ends.
+*/
+
+void ModelMapper::beginBatch()
+{
+    ++p_impl->m_batch_depth;
+}
+
+//! Finishes notification batch, emits collected notifications if it was the outermost batch.
+
+void ModelMapper::endBatch()
+{
+    if (p_impl->m_batch_depth == 0)
+        throw std::runtime_error("ModelMapper::endBatch() -> Error. No batch was started.");
+
+    if (--p_impl->m_batch_depth > 0)
+        return;
+
+    if (!p_impl->m_active) {
+        p_impl->clear_pending();
+        return;
+    }
+
+    try {
+        p_impl->flush_pending();
+    } catch (...) {
+        p_impl->clear_pending();
+        throw;
+    }
+}
+
+//! Returns true if notification batch is in progress.
+
+bool ModelMapper::isBatchActive() const
+{
+    return p_impl->m_batch_depth > 0;
+}
+
 //! Removes given client from all subscriptions.
 
 void ModelMapper::unsubscribe(Callbacks::slot_t client)
@@ -113,37 +291,64 @@ void ModelMapper::unsubscribe(Callbacks::slot_t client)
 
 void ModelMapper::callOnDataChange(SessionItem* item, int role)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_data_change(item, role);
+    if (!p_impl->m_active)
+        return;
+
+    if (p_impl->m_batch_depth > 0) {
+        p_impl->add_pending_data_change(item, role);
+        return;
+    }
+
+    p_impl->m_on_data_change(item, role);
+    p_impl->process_data_change(item, role);
 }
 
 //! Notifies all callbacks subscribed to "item data is changed" event.
 
 void ModelMapper::callOnItemInserted(SessionItem* parent, TagRow tagrow)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_item_inserted(parent, tagrow);
+    if (p_impl->m_batch_depth > 0)
+        p_impl->attach_pending_data_change(parent->getItem(tagrow.tag, tagrow.row));
+
+    if (!p_impl->m_active)
+        return;
+
+    p_impl->m_on_item_inserted(parent, tagrow);
+    if (auto mapper = p_impl->item_mapper(parent); mapper)
+        mapper->processItemInserted(parent, tagrow);
 }
 
 void ModelMapper::callOnItemRemoved(SessionItem* parent, TagRow tagrow)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_item_removed(parent, tagrow);
+    if (!p_impl->m_active)
+        return;
+
+    p_impl->m_on_item_removed(parent, tagrow);
+    if (auto mapper = p_impl->item_mapper(parent); mapper)
+        mapper->processItemRemoved(parent, tagrow);
 }
 
 void ModelMapper::callOnItemAboutToBeRemoved(SessionItem* parent, TagRow tagrow)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_item_about_removed(parent, tagrow);
+    p_impl->detach_pending_data_change(parent->getItem(tagrow.tag, tagrow.row));
+
+    if (!p_impl->m_active)
+        return;
+
+    p_impl->m_on_item_about_removed(parent, tagrow);
+    if (auto mapper = p_impl->item_mapper(parent); mapper)
+        mapper->processAboutToRemoveItem(parent, tagrow);
 }
 
 void ModelMapper::callOnModelDestroyed()
 {
+    p_impl->clear_pending();
     p_impl->m_on_model_destroyed(p_impl->m_model);
 }
 
 void ModelMapper::callOnModelAboutToBeReset()
 {
+    p_impl->clear_pending();
     p_impl->m_on_model_about_reset(p_impl->m_model);
 }
 
@@ -151,3 +356,33 @@ void ModelMapper::callOnModelReset()
 {
     p_impl->m_on_model_reset(p_impl->m_model);
 }
+
+//! Registers mapper to receive notifications related to given item and its children.
+
+void ModelMapper::registerItemMapper(const SessionItem* item, ItemMapper* mapper)
+{
+    p_impl->m_item_mappers[item] = mapper;
+}
+
+//! Removes mapper of given item from notifications.
+
+void ModelMapper::unregisterItemMapper(const SessionItem* item)
+{
+    p_impl->m_item_mappers.erase(item);
+}
+
+ModelMapper::BatchGuard::BatchGuard(ModelMapper* mapper) : m_mapper(mapper)
+{
+    m_mapper->beginBatch();
+}
+
+//! Finishes the batch. Exceptions thrown by callbacks while emitting collected notifications are
+//! not propagated, since the guard is often destroyed during stack unwinding.
+
+ModelMapper::BatchGuard::~BatchGuard() noexcept
+{
+    try {
+        m_mapper->endBatch();
+    } catch (...) {
+    }
+}
@@ -16,11 +16,14 @@
 namespace ModelView
 {
 
+class ItemMapper;
 class SessionItem;
 class SessionModel;
 
 //! Provides notifications on various SessionModel changes.
 //! Allows to subscribe to SessionModel's changes, and triggers notifications.
+//! Item-scoped events are routed only to ItemMapper's registered for the item and its ancestors,
+//! so the cost of notification doesn't depend on the number of subscribed items.
 
 class MVVM_MODEL_EXPORT ModelMapper : public ModelListenerInterface
 {
@@ -41,11 +44,30 @@ public:
 
     void setActive(bool value);
 
+    void beginBatch();
+    void endBatch();
+    bool isBatchActive() const;
+
+    //! Starts notification batch on construction and finishes it on destruction.
+    class MVVM_MODEL_EXPORT BatchGuard
+    {
+    public:
+        explicit BatchGuard(ModelMapper* mapper);
+        ~BatchGuard() noexcept;
+
+        BatchGuard(const BatchGuard& other) = delete;
+        BatchGuard& operator=(const BatchGuard& other) = delete;
+
+    private:
+        ModelMapper* m_mapper{nullptr};
+    };
+
     void unsubscribe(Callbacks::slot_t client) override;
 
 private:
     friend class SessionModel;
     friend class SessionItem;
+    friend class ItemMapper;
 
     void callOnDataChange(SessionItem* item, int role);
     void callOnItemInserted(SessionItem* parent, TagRow tagrow);
@@ -55,6 +77,9 @@ private:
     void callOnModelAboutToBeReset();
     void callOnModelReset();
 
+    void registerItemMapper(const SessionItem* item, ItemMapper* mapper);
+    void unregisterItemMapper(const SessionItem* item);
+
     struct ModelMapperImpl;
     std::unique_ptr<ModelMapperImpl> p_impl;
 };
@@ -69,7 +69,9 @@ std::pair<double, double> ColorMapViewportItem::data_yaxis_range() const
 void ColorMapViewportItem::update_data_range()
 {
     if (auto dataItem = data_item(); dataItem) {
-        auto values = dataItem->content();
+        auto values = dataItem->contentBuffer();
+        if (values.empty())
+            return;
         auto [lower, upper] = std::minmax_element(std::begin(values), std::end(values));
         zAxis()->set_range(*lower, *upper);
     }
@@ -52,6 +52,17 @@ void Data1DItem::setContent(const std::vector<double>& data)
     setData(data);
 }
 
+//! Sets internal data buffer to given data. The array is shared with given buffer,
+//! no copy is made.
+
+void Data1DItem::setContent(const DataBuffer& data)
+{
+    if (total_bin_count(this) != data.size())
+        throw std::runtime_error("Data1DItem::setContent() -> Data doesn't match size of axis");
+
+    setData(data.variant());
+}
+
 //! Returns coordinates of bin centers.
 
 std::vector<double> Data1DItem::binCenters() const
@@ -66,3 +77,10 @@ std::vector<double> Data1DItem::binValues() const
 {
     return data<std::vector<double>>();
 }
+
+//! Returns values stored in bins as a buffer sharing the array with the item. No copy is made.
+
+DataBuffer Data1DItem::binValuesBuffer() const
+{
+    return DataBuffer(data<QVariant>());
+}
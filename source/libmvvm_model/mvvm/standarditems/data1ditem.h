@@ -11,6 +11,7 @@
 #define MVVM_STANDARDITEMS_DATA1DITEM_H
 
 #include <mvvm/model/compounditem.h>
+#include <mvvm/model/databuffer.h>
 #include <vector>
 
 namespace ModelView
@@ -36,9 +37,13 @@ public:
 
     void setContent(const std::vector<double>& data);
 
+    void setContent(const DataBuffer& data);
+
     std::vector<double> binCenters() const;
 
     std::vector<double> binValues() const;
+
+    DataBuffer binValuesBuffer() const;
 };
 
 } // namespace ModelView
@@ -64,6 +64,17 @@ void Data2DItem::setContent(const std::vector<double>& data)
     setData(data);
 }
 
+//! Sets internal data buffer to given data. The array is shared with given buffer,
+//! no copy is made.
+
+void Data2DItem::setContent(const DataBuffer& data)
+{
+    if (total_bin_count(this) != data.size())
+        throw std::runtime_error("Data2DItem::setContent() -> Data doesn't match size of axis");
+
+    setData(data.variant());
+}
+
 //! Returns 2d vector representing 2d data.
 
 std::vector<double> Data2DItem::content() const
@@ -71,6 +82,14 @@ std::vector<double> Data2DItem::content() const
     return data<std::vector<double>>();
 }
 
+//! Returns 2d vector representing 2d data as a buffer sharing the array with the item.
+//! No copy is made.
+
+DataBuffer Data2DItem::contentBuffer() const
+{
+    return DataBuffer(data<QVariant>());
+}
+
 //! Insert axis under given tag. Previous axis will be deleted and data points invalidated.
 
 void Data2DItem::insert_axis(std::unique_ptr<BinnedAxisItem> axis, const std::string& tag)
@@ -11,6 +11,7 @@
 #define MVVM_STANDARDITEMS_DATA2DITEM_H
 
 #include <mvvm/model/compounditem.h>
+#include <mvvm/model/databuffer.h>
 #include <vector>
 
 namespace ModelView
@@ -41,8 +42,12 @@ public:
 
     void setContent(const std::vector<double>& data);
 
+    void setContent(const DataBuffer& data);
+
     std::vector<double> content() const;
 
+    DataBuffer contentBuffer() const;
+
 private:
     void insert_axis(std::unique_ptr<BinnedAxisItem> axis, const std::string& tag);
 };
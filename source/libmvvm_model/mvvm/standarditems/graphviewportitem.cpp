@@ -8,6 +8,8 @@
 // ************************************************************************** //
 
 #include <algorithm>
+#include <limits>
+#include <mvvm/standarditems/data1ditem.h>
 #include <mvvm/standarditems/graphitem.h>
 #include <mvvm/standarditems/graphviewportitem.h>
 #include <vector>
@@ -25,14 +27,20 @@ const double failback_max = 1.0;
 
 template <typename T> auto get_min_max(const std::vector<GraphItem*>& graphs, T func)
 {
-    std::vector<double> values;
+    size_t count{0};
+    double xmin = std::numeric_limits<double>::max();
+    double xmax = std::numeric_limits<double>::lowest();
     for (auto graph : graphs) {
         const auto array = func(graph);
-        std::copy(std::begin(array), std::end(array), std::back_inserter(values));
+        if (std::begin(array) == std::end(array))
+            continue;
+        auto [lower, upper] = std::minmax_element(std::begin(array), std::end(array));
+        xmin = std::min(xmin, *lower);
+        xmax = std::max(xmax, *upper);
+        count += array.size();
     }
 
-    auto [xmin, xmax] = std::minmax_element(std::begin(values), std::end(values));
-    return xmin != xmax ? std::make_pair(*xmin, *xmax) : std::make_pair(failback_min, failback_max);
+    return count > 1 ? std::make_pair(xmin, xmax) : std::make_pair(failback_min, failback_max);
 }
 
 } // namespace
@@ -94,5 +102,7 @@ std::pair<double, double> GraphViewportItem::data_xaxis_range() const
 
 std::pair<double, double> GraphViewportItem::data_yaxis_range() const
 {
-    return get_min_max(visibleGraphItems(), [](GraphItem* graph) { return graph->binValues(); });
+    return get_min_max(visibleGraphItems(), [](GraphItem* graph) {
+        return graph->dataItem() ? graph->dataItem()->binValuesBuffer() : DataBuffer();
+    });
 }
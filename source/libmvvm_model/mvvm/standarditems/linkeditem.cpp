@@ -7,6 +7,7 @@
 //
 // ************************************************************************** //
 
+#include <mvvm/core/uniqueid.h>
 #include <mvvm/model/customvariants.h>
 #include <mvvm/standarditems/linkeditem.h>
 
@@ -14,9 +15,9 @@ using namespace ModelView;
 
 LinkedItem::LinkedItem() : SessionItem(Constants::LinkedItemType) {}
 
-//! Set link to given item.
+//! Set link to given item. Identifier is stored in its textual form.
 
 void LinkedItem::setLink(const SessionItem* item)
 {
-    setData(item ? QVariant::fromValue(item->identifier()) : QVariant());
+    setData(item ? QVariant::fromValue(Utils::IdentifierToString(item->identifier())) : QVariant());
 }
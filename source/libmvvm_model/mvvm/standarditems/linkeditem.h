@@ -10,6 +10,7 @@
 #ifndef MVVM_STANDARDITEMS_LINKEDITEM_H
 #define MVVM_STANDARDITEMS_LINKEDITEM_H
 
+#include <mvvm/core/uniqueid.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
 
@@ -38,7 +39,10 @@ public:
 
 template <typename T> T* LinkedItem::get() const
 {
-    return model() ? dynamic_cast<T*>(model()->findItem(data<std::string>())) : nullptr;
+    if (!model())
+        return nullptr;
+    auto identifier = Utils::IdentifierFromString(data<std::string>());
+    return dynamic_cast<T*>(model()->findItem(identifier));
 }
 
 } // namespace ModelView
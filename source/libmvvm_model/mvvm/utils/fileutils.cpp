@@ -29,6 +29,16 @@ bool Utils::exists(const std::string& fileName)
 #endif
 }
 
+bool Utils::is_directory(const std::string& path)
+{
+#ifdef ENABLE_FILESYSTEM
+    return std::filesystem::is_directory(path);
+#else
+    QFileInfo info(QString::fromStdString(path));
+    return info.isDir();
+#endif
+}
+
 std::string Utils::join(const std::string& part1, const std::string& part2)
 {
 #ifdef ENABLE_FILESYSTEM
@@ -23,6 +23,9 @@ namespace Utils
 //! Returns true if file exists.
 MVVM_MODEL_EXPORT bool exists(const std::string& fileName);
 
+//! Returns true if path refers to existing directory.
+MVVM_MODEL_EXPORT bool is_directory(const std::string& path);
+
 //! Joins two path elements into the path.
 MVVM_MODEL_EXPORT std::string join(const std::string& part1, const std::string& part2);
 
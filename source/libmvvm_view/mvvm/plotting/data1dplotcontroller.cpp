@@ -8,19 +8,19 @@
 // ************************************************************************** //
 
 #include "qcustomplot.h"
+#include <algorithm>
 #include <mvvm/plotting/data1dplotcontroller.h>
 #include <mvvm/standarditems/data1ditem.h>
 #include <stdexcept>
 
 namespace
 {
-template <typename T> QVector<T> fromStdVector(const std::vector<T>& vec)
+//! Returns QVector with the copy of given container content (std::vector, DataBuffer).
+template <typename C> QVector<double> toQVector(const C& container)
 {
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-    return QVector<T>(vec.begin(), vec.end());
-#else
-    return QVector<T>::fromStdVector(vec);
-#endif
+    QVector<double> result(static_cast<int>(container.size()));
+    std::copy(container.begin(), container.end(), result.begin());
+    return result;
 }
 } // namespace
 
@@ -38,8 +38,8 @@ struct Data1DPlotController::Data1DPlotControllerImpl {
     {
         auto data_item = controller->currentItem();
         if (data_item) {
-            m_graph->setData(fromStdVector<double>(data_item->binCenters()),
-                             fromStdVector<double>(data_item->binValues()));
+            m_graph->setData(toQVector(data_item->binCenters()),
+                             toQVector(data_item->binValuesBuffer()));
             m_graph->parentPlot()->replot();
         }
     }
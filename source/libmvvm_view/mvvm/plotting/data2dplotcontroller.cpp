@@ -45,14 +45,16 @@ struct Data2DPlotController::Data2DPlotControllerImpl {
         if (auto data_item = dataItem(); data_item) {
             auto xAxis = data_item->xAxis();
             auto yAxis = data_item->yAxis();
-            if (xAxis && yAxis) {
+            auto values = data_item->contentBuffer();
+            // buffer not matching the axes (e.g. while they are being set up) is not shown
+            if (xAxis && yAxis && !values.empty()
+                && values.size() == static_cast<size_t>(xAxis->size() * yAxis->size())) {
                 const int nbinsx = xAxis->size();
                 const int nbinsy = yAxis->size();
 
                 color_map->data()->setSize(nbinsx, nbinsy);
                 color_map->data()->setRange(qcpRange(xAxis), qcpRange(yAxis));
 
-                auto values = data_item->content();
                 for (int ix = 0; ix < nbinsx; ++ix)
                     for (int iy = 0; iy < nbinsy; ++iy)
                         color_map->data()->setCell(ix, iy,
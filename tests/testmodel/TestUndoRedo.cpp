@@ -15,6 +15,8 @@
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/model/taginfo.h>
+#include <mvvm/signals/modelmapper.h>
+#include <stdexcept>
 
 using namespace ModelView;
 
@@ -165,6 +167,75 @@ TEST_F(TestUndoRedo, setData)
     EXPECT_EQ(model.data(item, role).value<double>(), 44.0);
 }
 
+//! Consecutive changes of the same item's data within edit session are merged into single command.
+
+TEST_F(TestUndoRedo, setDataInEditSession)
+{
+    const int role = ItemDataRole::DATA;
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+
+    auto item1 = model.insertItem<SessionItem>();
+    auto item2 = model.insertItem<SessionItem>();
+    model.setData(item1, QVariant::fromValue(1.0), role);
+    EXPECT_EQ(stack->index(), 3);
+
+    // many changes of the same item during the session result in single command
+    model.beginEditSession();
+    for (int i = 0; i < 100; ++i)
+        model.setData(item1, QVariant::fromValue(2.0 + i), role);
+    EXPECT_EQ(stack->index(), 4);
+    EXPECT_EQ(stack->count(), 4);
+
+    // change of another item isn't merged
+    model.setData(item2, QVariant::fromValue(42.0), role);
+    EXPECT_EQ(stack->index(), 5);
+    model.endEditSession();
+
+    // changes outside of the session aren't merged
+    model.setData(item2, QVariant::fromValue(43.0), role);
+    EXPECT_EQ(stack->index(), 6);
+
+    // undoing all changes of the session at once
+    stack->undo();
+    stack->undo();
+    stack->undo();
+    EXPECT_EQ(model.data(item1, role).value<double>(), 1.0);
+    EXPECT_FALSE(model.data(item2, role).isValid());
+
+    stack->redo();
+    EXPECT_EQ(model.data(item1, role).value<double>(), 101.0);
+}
+
+//! Consecutive changes of the same item's data within merge window are merged into single command.
+
+TEST_F(TestUndoRedo, setDataWithinMergeWindow)
+{
+    const int role = ItemDataRole::DATA;
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    model.setUndoMergeWindow(60000);
+    auto stack = model.undoStack();
+
+    auto item = model.insertItem<SessionItem>();
+    model.setData(item, QVariant::fromValue(42.0), role);
+    model.setData(item, QVariant::fromValue(43.0), role);
+    model.setData(item, QVariant::fromValue(44.0), role);
+    EXPECT_EQ(stack->index(), 2);
+
+    stack->undo();
+    EXPECT_FALSE(model.data(item, role).isValid());
+    stack->redo();
+    EXPECT_EQ(model.data(item, role).value<double>(), 44.0);
+
+    // disabling merge window
+    model.setUndoMergeWindow(0);
+    model.setData(item, QVariant::fromValue(45.0), role);
+    model.setData(item, QVariant::fromValue(46.0), role);
+    EXPECT_EQ(stack->index(), 4);
+}
+
 //! Undo/redo scenario when item data changed through item and not the model.
 
 TEST_F(TestUndoRedo, setDataThroughItem)
@@ -622,3 +693,259 @@ TEST_F(TestUndoRedo, copyLayerFromMultilayer)
     EXPECT_EQ(multilayer1->itemCount(ToyItems::MultiLayerItem::T_LAYERS), 1);
     EXPECT_EQ(multilayer1->getItems(ToyItems::MultiLayerItem::T_LAYERS)[0]->identifier(), id);
 }
+
+//! Several changes made within transaction become single undo command.
+
+TEST_F(TestUndoRedo, commitTransaction)
+{
+    ToyItems::SampleModel model;
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+
+    auto parent = model.insertItem<ToyItems::MultiLayerItem>();
+    EXPECT_EQ(stack->index(), 1);
+
+    model.beginTransaction("Add layers");
+    auto layer0 = model.insertItem<ToyItems::LayerItem>(parent);
+    auto layer1 = model.insertItem<ToyItems::LayerItem>(parent);
+    layer0->setProperty(ToyItems::LayerItem::P_THICKNESS, 42.0);
+    layer1->setProperty(ToyItems::LayerItem::P_THICKNESS, 43.0);
+    model.commitTransaction();
+
+    EXPECT_EQ(stack->count(), 2);
+    EXPECT_EQ(stack->index(), 2);
+    EXPECT_EQ(stack->text(1), QString("Add layers"));
+
+    // undoing whole transaction at once
+    stack->undo();
+    EXPECT_EQ(parent->childrenCount(), 0);
+
+    // redoing whole transaction
+    stack->redo();
+    auto layers = parent->getItems(ToyItems::MultiLayerItem::T_LAYERS);
+    ASSERT_EQ(layers.size(), 2u);
+    EXPECT_EQ(layers[0]->property<double>(ToyItems::LayerItem::P_THICKNESS), 42.0);
+    EXPECT_EQ(layers[1]->property<double>(ToyItems::LayerItem::P_THICKNESS), 43.0);
+}
+
+//! Rolling back transaction returns model to original state and leaves undo stack intact.
+
+TEST_F(TestUndoRedo, rollbackTransaction)
+{
+    ToyItems::SampleModel model;
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+
+    auto parent = model.insertItem<ToyItems::MultiLayerItem>();
+    auto layer0 = model.insertItem<ToyItems::LayerItem>(parent);
+    layer0->setProperty(ToyItems::LayerItem::P_THICKNESS, 42.0);
+    EXPECT_EQ(stack->index(), 3);
+
+    model.beginTransaction();
+    model.insertItem<ToyItems::LayerItem>(parent);
+    layer0->setProperty(ToyItems::LayerItem::P_THICKNESS, 43.0);
+    model.removeItem(parent, {ToyItems::MultiLayerItem::T_LAYERS, 0});
+    EXPECT_EQ(parent->childrenCount(), 1);
+    model.rollbackTransaction();
+
+    EXPECT_EQ(stack->count(), 3);
+    EXPECT_EQ(stack->index(), 3);
+    auto layers = parent->getItems(ToyItems::MultiLayerItem::T_LAYERS);
+    ASSERT_EQ(layers.size(), 1u);
+    EXPECT_EQ(layers[0]->property<double>(ToyItems::LayerItem::P_THICKNESS), 42.0);
+}
+
+//! Commands in the undo stack can't be undone or redone while transaction is active.
+
+TEST_F(TestUndoRedo, undoWithinTransaction)
+{
+    ToyItems::SampleModel model;
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+
+    auto parent = model.insertItem<ToyItems::MultiLayerItem>();
+    model.insertItem<ToyItems::LayerItem>(parent);
+    stack->undo();
+    EXPECT_EQ(stack->index(), 1);
+
+    model.beginTransaction();
+    model.insertItem<ToyItems::LayerItem>(parent);
+    EXPECT_THROW(stack->undo(), std::runtime_error);
+    EXPECT_THROW(stack->redo(), std::runtime_error);
+    EXPECT_THROW(stack->setIndex(0), std::runtime_error);
+    EXPECT_THROW(model.setUndoIndex(0), std::runtime_error);
+    EXPECT_EQ(stack->index(), 1);
+    EXPECT_EQ(parent->childrenCount(), 1);
+    model.commitTransaction();
+
+    // stack is unlocked after the end of the transaction
+    EXPECT_EQ(stack->index(), 2);
+    stack->undo();
+    stack->undo();
+    EXPECT_EQ(stack->index(), 0);
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+}
+
+//! Exception thrown in the middle of transaction rolls back all changes made so far.
+
+TEST_F(TestUndoRedo, transactionGuard)
+{
+    ToyItems::SampleModel model;
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+
+    auto parent = model.insertItem<ToyItems::MultiLayerItem>();
+
+    auto failing_change = [&model, parent]() {
+        SessionModel::TransactionGuard guard(&model);
+        model.insertItem<ToyItems::LayerItem>(parent);
+        throw std::runtime_error("Failure");
+    };
+    EXPECT_THROW(failing_change(), std::runtime_error);
+    EXPECT_EQ(parent->childrenCount(), 0);
+    EXPECT_EQ(stack->count(), 1);
+
+    {
+        SessionModel::TransactionGuard guard(&model);
+        model.insertItem<ToyItems::LayerItem>(parent);
+        model.insertItem<ToyItems::LayerItem>(parent);
+        guard.commit();
+    }
+    EXPECT_EQ(parent->childrenCount(), 2);
+    EXPECT_EQ(stack->count(), 2);
+
+    // nested transactions are not allowed
+    model.beginTransaction();
+    EXPECT_THROW(model.beginTransaction(), std::runtime_error);
+    model.commitTransaction();
+    EXPECT_THROW(model.commitTransaction(), std::runtime_error);
+}
+
+//! Memory usage of undo stack follows the data kept by commands.
+
+TEST_F(TestUndoRedo, undoMemoryUsage)
+{
+    SessionModel model;
+    EXPECT_EQ(model.undoMemoryUsage(), 0u);
+
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+    EXPECT_EQ(model.undoMemoryUsage(), 0u);
+
+    const std::vector<double> data(10000, 42.0);
+    const std::size_t data_size = data.size() * sizeof(double);
+
+    auto item = model.insertItem<SessionItem>();
+    model.setData(item, QVariant::fromValue(data), ItemDataRole::DATA);
+    EXPECT_GT(model.undoMemoryUsage(), 0u);
+    EXPECT_LT(model.undoMemoryUsage(), data_size);
+
+    // removed item with its data is kept in the stack
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_GT(model.undoMemoryUsage(), data_size);
+
+    // item is back in the model, nothing to keep
+    stack->undo();
+    EXPECT_LT(model.undoMemoryUsage(), data_size);
+
+    stack->redo();
+    EXPECT_GT(model.undoMemoryUsage(), data_size);
+
+    stack->clear();
+    EXPECT_EQ(model.undoMemoryUsage(), 0u);
+}
+
+//! Oldest commands are evicted when memory budget is exceeded.
+
+TEST_F(TestUndoRedo, undoMemoryLimit)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+
+    const std::vector<double> data(10000, 42.0);
+    const std::size_t data_size = data.size() * sizeof(double);
+
+    auto item = model.insertItem<SessionItem>();
+    model.setData(item, QVariant::fromValue(data), ItemDataRole::DATA);
+    model.removeItem(model.rootItem(), {"", 0});
+    model.insertItem<SessionItem>();
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_EQ(stack->count(), 5);
+    EXPECT_GT(model.undoMemoryUsage(), data_size);
+
+    // first three commands are evicted
+    model.setUndoMemoryLimit(data_size / 2);
+    EXPECT_LT(model.undoMemoryUsage(), data_size / 2);
+    EXPECT_EQ(stack->count(), 5);
+
+    // remaining commands can be undone as usual
+    stack->undo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 1);
+    stack->undo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+
+    // evicted commands stay in the stack as no-op entries, each undo step drops one of them
+    EXPECT_TRUE(stack->canUndo());
+    stack->undo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+    EXPECT_EQ(stack->count(), 4);
+    stack->undo();
+    stack->undo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+    EXPECT_EQ(stack->count(), 2);
+    EXPECT_EQ(stack->index(), 0);
+    EXPECT_FALSE(stack->canUndo());
+
+    // commands which were not evicted can be redone
+    stack->redo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 1);
+    stack->redo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+
+    // last executed command is kept even if it alone exceeds the budget
+    model.setUndoMemoryLimit(1);
+    auto big_item = model.insertItem<SessionItem>();
+    model.setData(big_item, QVariant::fromValue(data), ItemDataRole::DATA);
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_GT(model.undoMemoryUsage(), data_size);
+    stack->undo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 1);
+}
+
+//! Jumping to given position in the undo stack notifies about data change only once.
+
+TEST_F(TestUndoRedo, setUndoIndex)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+
+    auto item = model.insertItem<PropertyItem>();
+    for (int i = 1; i <= 100; ++i)
+        model.setData(item, static_cast<double>(i), ItemDataRole::DATA);
+    EXPECT_EQ(stack->index(), 101);
+
+    int notification_count{0};
+    auto on_data_change = [&notification_count](SessionItem*, int) { ++notification_count; };
+    model.mapper()->setOnDataChange(on_data_change, this);
+
+    model.setUndoIndex(11);
+    EXPECT_EQ(stack->index(), 11);
+    EXPECT_EQ(item->data<double>(), 10.0);
+    EXPECT_EQ(notification_count, 1);
+
+    model.setUndoIndex(101);
+    EXPECT_EQ(stack->index(), 101);
+    EXPECT_EQ(item->data<double>(), 100.0);
+    EXPECT_EQ(notification_count, 2);
+
+    // going to the beginning removes the item
+    model.setUndoIndex(0);
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+    EXPECT_EQ(notification_count, 2);
+
+    model.setUndoIndex(stack->count());
+    EXPECT_EQ(Utils::ChildAt(model.rootItem(), 0)->data<double>(), 100.0);
+    model.mapper()->unsubscribe(this);
+}
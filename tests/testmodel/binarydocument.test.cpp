@@ -0,0 +1,79 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "folderbasedtest.h"
+#include "google_test.h"
+#include "test_utils.h"
+#include <mvvm/model/propertyitem.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/serialization/binarydocument.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Tests BinaryDocument class
+
+class BinaryDocumentTest : public FolderBasedTest
+{
+public:
+    BinaryDocumentTest() : FolderBasedTest("test_BinaryDocument") {}
+    ~BinaryDocumentTest();
+};
+
+BinaryDocumentTest::~BinaryDocumentTest() = default;
+
+//! Saving two models with content into document and restoring it after.
+
+TEST_F(BinaryDocumentTest, saveLoadTwoModels)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "saveLoadTwoModels.mvb");
+    SessionModel model1("TestModel1");
+    SessionModel model2("TestModel2");
+    BinaryDocument document({&model1, &model2});
+
+    auto parent1 = model1.insertItem<SessionItem>();
+    const auto parent_identifier1 = parent1->identifier();
+    auto parent2 = model2.insertItem<PropertyItem>();
+    parent2->setData(42.0);
+    const auto parent_identifier2 = parent2->identifier();
+
+    document.save(fileName);
+
+    model1.removeItem(model1.rootItem(), {"", 0});
+    model2.removeItem(model2.rootItem(), {"", 0});
+
+    document.load(fileName);
+
+    auto reco_parent1 = model1.rootItem()->getItem("", 0);
+    EXPECT_EQ(reco_parent1->model(), &model1);
+    EXPECT_EQ(reco_parent1->identifier(), parent_identifier1);
+
+    auto reco_parent2 = model2.rootItem()->getItem("", 0);
+    EXPECT_EQ(reco_parent2->model(), &model2);
+    EXPECT_EQ(reco_parent2->identifier(), parent_identifier2);
+    EXPECT_EQ(reco_parent2->data<double>(), 42.0);
+}
+
+//! Attempt to restore models in wrong order or into wrong number of models.
+
+TEST_F(BinaryDocumentTest, loadModelsInWrongOrder)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "loadModelsInWrongOrder.mvb");
+    SessionModel model1("TestModel1");
+    SessionModel model2("TestModel2");
+
+    BinaryDocument({&model1, &model2}).save(fileName);
+
+    BinaryDocument document({&model2, &model1});
+    EXPECT_THROW(document.load(fileName), std::runtime_error);
+
+    BinaryDocument document2({&model1});
+    EXPECT_THROW(document2.load(fileName), std::runtime_error);
+}
@@ -0,0 +1,116 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <QBuffer>
+#include <QDataStream>
+#include <mvvm/model/propertyitem.h>
+#include <mvvm/model/sessionitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/model/taginfo.h>
+#include <mvvm/serialization/binarymodelconverter.h>
+#include <mvvm/serialization/binaryutils.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Checks BinaryModelConverter class and its ability to convert SessionModel to binary and back.
+
+class BinaryModelConverterTest : public ::testing::Test
+{
+public:
+    ~BinaryModelConverterTest();
+
+    static QByteArray ToBytes(const SessionModel& model)
+    {
+        QByteArray result;
+        QDataStream stream(&result, QIODevice::WriteOnly);
+        BinaryUtils::SetupStream(stream);
+        BinaryModelConverter().model_to_stream(model, stream);
+        return result;
+    }
+
+    static void FromBytes(QByteArray bytes, SessionModel& model)
+    {
+        QBuffer buffer(&bytes);
+        buffer.open(QIODevice::ReadOnly);
+        QDataStream stream(&buffer);
+        BinaryUtils::SetupStream(stream);
+        BinaryModelConverter().stream_to_model(stream, model);
+    }
+};
+
+BinaryModelConverterTest::~BinaryModelConverterTest() = default;
+
+//! Empty model to binary and back.
+
+TEST_F(BinaryModelConverterTest, emptyModel)
+{
+    SessionModel model("TestModel");
+    auto bytes = ToBytes(model);
+
+    // attempt to reconstruct model of different type
+    SessionModel target1("NewModel");
+    EXPECT_THROW(FromBytes(bytes, target1), std::runtime_error);
+
+    // non-empty model is cleared
+    SessionModel target2("TestModel");
+    target2.insertItem<SessionItem>();
+    EXPECT_NO_THROW(FromBytes(bytes, target2));
+    EXPECT_EQ(target2.rootItem()->childrenCount(), 0);
+}
+
+//! Parent and child in a model to binary and back.
+
+TEST_F(BinaryModelConverterTest, parentAndChild)
+{
+    SessionModel model("TestModel");
+
+    auto parent = model.insertItem<SessionItem>();
+    parent->setDisplayName("parent_name");
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    parent->setData(QVariant::fromValue(42));
+    auto child = model.insertItem<PropertyItem>(parent);
+    child->setDisplayName("child_name");
+    child->setData(std::vector<double>{1.0, 2.0, 3.0});
+
+    SessionModel target("TestModel");
+    FromBytes(ToBytes(model), target);
+
+    auto reco_parent = target.rootItem()->getItem("", 0);
+    EXPECT_EQ(reco_parent->model(), &target);
+    EXPECT_EQ(reco_parent->modelType(), Constants::BaseType);
+    EXPECT_EQ(reco_parent->parent(), target.rootItem());
+    EXPECT_EQ(reco_parent->displayName(), "parent_name");
+    EXPECT_EQ(reco_parent->identifier(), parent->identifier());
+    EXPECT_EQ(reco_parent->defaultTag(), "defaultTag");
+    EXPECT_EQ(reco_parent->data<int>(), 42);
+    EXPECT_EQ(reco_parent->childrenCount(), 1);
+
+    auto reco_child = reco_parent->getItem("", 0);
+    EXPECT_EQ(reco_child->model(), &target);
+    EXPECT_EQ(reco_child->modelType(), Constants::PropertyType);
+    EXPECT_EQ(reco_child->parent(), reco_parent);
+    EXPECT_EQ(reco_child->displayName(), "child_name");
+    EXPECT_EQ(reco_child->identifier(), child->identifier());
+    EXPECT_EQ(reco_child->data<std::vector<double>>(), std::vector<double>({1.0, 2.0, 3.0}));
+}
+
+//! Corrupted or foreign data is rejected.
+
+TEST_F(BinaryModelConverterTest, invalidData)
+{
+    SessionModel model("TestModel");
+    model.insertItem<SessionItem>();
+    auto bytes = ToBytes(model);
+
+    SessionModel target("TestModel");
+    EXPECT_THROW(FromBytes(QByteArray("abcdefgh"), target), std::runtime_error);
+    EXPECT_THROW(FromBytes(bytes.left(bytes.size() / 2), target), std::runtime_error);
+}
@@ -0,0 +1,172 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <QBuffer>
+#include <QColor>
+#include <QDataStream>
+#include <mvvm/core/uniqueid.h>
+#include <mvvm/model/comboproperty.h>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/externalproperty.h>
+#include <mvvm/serialization/binarystringtable.h>
+#include <mvvm/serialization/binaryutils.h>
+#include <mvvm/serialization/binaryvariant.h>
+#include <mvvm/utils/reallimits.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace ModelView;
+
+//! Test convertion of QVariant from/to binary stream.
+
+class BinaryVariantTest : public ::testing::Test
+{
+public:
+    ~BinaryVariantTest();
+
+    static QVariant ToStreamAndBack(const QVariant& variant)
+    {
+        BinaryVariant converter;
+        BinaryStringTable table;
+        QByteArray bytes;
+        {
+            QDataStream stream(&bytes, QIODevice::WriteOnly);
+            BinaryUtils::SetupStream(stream);
+            converter.to_stream(variant, stream, table);
+        }
+
+        // reading side builds its own table
+        BinaryStringTable reco_table;
+        QBuffer buffer(&bytes);
+        buffer.open(QIODevice::ReadOnly);
+        QDataStream stream(&buffer);
+        BinaryUtils::SetupStream(stream);
+        return converter.from_stream(stream, reco_table);
+    }
+};
+
+BinaryVariantTest::~BinaryVariantTest() = default;
+
+TEST_F(BinaryVariantTest, invalidVariant)
+{
+    EXPECT_FALSE(ToStreamAndBack(QVariant()).isValid());
+}
+
+TEST_F(BinaryVariantTest, basicVariants)
+{
+    auto reco_bool = ToStreamAndBack(QVariant::fromValue(true));
+    EXPECT_TRUE(Utils::IsBoolVariant(reco_bool));
+    EXPECT_EQ(reco_bool.value<bool>(), true);
+
+    auto reco_int = ToStreamAndBack(QVariant::fromValue(42));
+    EXPECT_TRUE(Utils::IsIntVariant(reco_int));
+    EXPECT_EQ(reco_int.value<int>(), 42);
+
+    auto reco_double = ToStreamAndBack(QVariant::fromValue(0.1 + 0.2));
+    EXPECT_TRUE(Utils::IsDoubleVariant(reco_double));
+    EXPECT_EQ(reco_double.value<double>(), 0.1 + 0.2); // exact, no decimal round trip
+
+    auto reco_string = ToStreamAndBack(QVariant::fromValue(std::string("abc")));
+    EXPECT_TRUE(Utils::IsStdStringVariant(reco_string));
+    EXPECT_EQ(reco_string.value<std::string>(), std::string("abc"));
+}
+
+TEST_F(BinaryVariantTest, vectorOfDoubleVariant)
+{
+    const std::vector<double> expected = {1.0, 1.0 / 3.0, -42.0, 1e-300};
+    auto reco_variant = ToStreamAndBack(QVariant::fromValue(expected));
+    EXPECT_TRUE(Utils::IsDoubleVectorVariant(reco_variant));
+    EXPECT_EQ(reco_variant.value<std::vector<double>>(), expected);
+
+    auto reco_empty = ToStreamAndBack(QVariant::fromValue(std::vector<double>()));
+    EXPECT_TRUE(reco_empty.value<std::vector<double>>().empty());
+}
+
+TEST_F(BinaryVariantTest, customVariants)
+{
+    auto combo = ComboProperty::createFrom({"a1", "a2", "s3"});
+    combo.setSelected(1, true);
+    EXPECT_EQ(ToStreamAndBack(QVariant::fromValue(combo)).value<ComboProperty>(), combo);
+
+    QColor color(Qt::red);
+    EXPECT_EQ(ToStreamAndBack(QVariant::fromValue(color)).value<QColor>(), color);
+
+    ExternalProperty property("text", QColor(Qt::green), "123");
+    EXPECT_EQ(ToStreamAndBack(QVariant::fromValue(property)).value<ExternalProperty>(), property);
+
+    auto limits = RealLimits::limited(0.123, 0.124);
+    EXPECT_EQ(ToStreamAndBack(QVariant::fromValue(limits)).value<RealLimits>(), limits);
+    limits = RealLimits::positive();
+    EXPECT_EQ(ToStreamAndBack(QVariant::fromValue(limits)).value<RealLimits>(), limits);
+}
+
+//! UniqueId is written in textual form and is read back as string.
+
+TEST_F(BinaryVariantTest, uniqueIdVariant)
+{
+    UniqueId id(0x0123456789abcdefull, 0xfedcba9876543210ull);
+    auto reco_variant = ToStreamAndBack(QVariant::fromValue(id));
+    EXPECT_TRUE(Utils::IsStdStringVariant(reco_variant));
+    EXPECT_EQ(reco_variant.value<std::string>(), id.toString());
+}
+
+//! Same strings are stored in the table only once. Reading side rebuilds the same table.
+
+TEST_F(BinaryVariantTest, stringTable)
+{
+    BinaryVariant converter;
+    BinaryStringTable table;
+    QByteArray bytes;
+    {
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        BinaryUtils::SetupStream(stream);
+        converter.to_stream(QVariant::fromValue(std::string("abc")), stream, table);
+        converter.to_stream(QVariant::fromValue(std::string("abc")), stream, table);
+        converter.to_stream(QVariant::fromValue(std::string("def")), stream, table);
+    }
+
+    // type name and two strings
+    EXPECT_EQ(table.size(), 3u);
+    EXPECT_EQ(table.string(table.index("def")), std::string("def"));
+    EXPECT_THROW(table.string(42), std::runtime_error);
+
+    BinaryStringTable reco_table;
+    QBuffer buffer(&bytes);
+    buffer.open(QIODevice::ReadOnly);
+    QDataStream stream(&buffer);
+    BinaryUtils::SetupStream(stream);
+    EXPECT_EQ(converter.from_stream(stream, reco_table).value<std::string>(), "abc");
+    EXPECT_EQ(converter.from_stream(stream, reco_table).value<std::string>(), "abc");
+    EXPECT_EQ(converter.from_stream(stream, reco_table).value<std::string>(), "def");
+    EXPECT_EQ(reco_table.size(), 3u);
+    EXPECT_TRUE(stream.atEnd());
+}
+
+//! Truncated data is reported.
+
+TEST_F(BinaryVariantTest, truncatedData)
+{
+    BinaryVariant converter;
+    BinaryStringTable table;
+    QByteArray bytes;
+    {
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        BinaryUtils::SetupStream(stream);
+        converter.to_stream(QVariant::fromValue(std::vector<double>(10, 1.0)), stream, table);
+    }
+    bytes.chop(8);
+
+    BinaryStringTable reco_table;
+    QBuffer buffer(&bytes);
+    buffer.open(QIODevice::ReadOnly);
+    QDataStream stream(&buffer);
+    BinaryUtils::SetupStream(stream);
+    EXPECT_THROW(converter.from_stream(stream, reco_table), std::runtime_error);
+}
@@ -0,0 +1,81 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "folderbasedtest.h"
+#include "google_test.h"
+#include <mvvm/serialization/blobstorage.h>
+#include <mvvm/utils/fileutils.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Tests BlobStorage class.
+
+class BlobStorageTest : public FolderBasedTest
+{
+public:
+    BlobStorageTest() : FolderBasedTest("test_BlobStorage") {}
+    ~BlobStorageTest();
+};
+
+BlobStorageTest::~BlobStorageTest() = default;
+
+TEST_F(BlobStorageTest, initialState)
+{
+    BlobStorage storage("abc");
+    EXPECT_EQ(storage.dirName(), std::string("abc"));
+    EXPECT_EQ(storage.threshold(), BlobStorage::defaultThreshold);
+}
+
+//! Storing array and reading it back.
+
+TEST_F(BlobStorageTest, storeAndLoad)
+{
+    auto dirname = createEmptyDir("storeAndLoad");
+    BlobStorage storage(dirname);
+
+    const std::vector<double> values = {1.0, -2.5, 3e+300};
+    auto name = storage.store("{1234-abcd}", values);
+    EXPECT_TRUE(Utils::exists(Utils::join(dirname, name)));
+    EXPECT_EQ(name.find('{'), std::string::npos);
+
+    EXPECT_EQ(storage.load(name, values.size()), values);
+
+    // same content gives same blob, different content gives another one
+    EXPECT_EQ(storage.store("{1234-abcd}", values), name);
+    EXPECT_NE(storage.store("{1234-abcd}", {1.0, 2.0}), name);
+
+    // wrong size, invalid name, missing blob
+    EXPECT_THROW(storage.load(name, values.size() + 1), std::runtime_error);
+    EXPECT_THROW(storage.load("../" + name, values.size()), std::runtime_error);
+    EXPECT_THROW(storage.load("abc.bin", values.size()), std::runtime_error);
+
+    // empty array
+    auto empty_name = storage.store("empty", {});
+    EXPECT_TRUE(storage.load(empty_name, 0).empty());
+}
+
+//! Blobs not referenced by the storage are removed.
+
+TEST_F(BlobStorageTest, removeUnused)
+{
+    auto dirname = createEmptyDir("removeUnused");
+
+    BlobStorage storage(dirname);
+    auto name1 = storage.store("id1", {1.0});
+    auto name2 = storage.store("id2", {2.0});
+
+    // new storage references only the second blob
+    BlobStorage storage2(dirname);
+    EXPECT_EQ(storage2.store("id2", {2.0}), name2);
+    storage2.removeUnused();
+
+    EXPECT_FALSE(Utils::exists(Utils::join(dirname, name1)));
+    EXPECT_TRUE(Utils::exists(Utils::join(dirname, name2)));
+}
@@ -13,6 +13,8 @@
 #include <mvvm/model/mvvm_types.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/signals/callbackcontainer.h>
+#include <stdexcept>
+#include <vector>
 
 using namespace ModelView;
 using ::testing::_;
@@ -108,3 +110,72 @@ TEST_F(CallbackContainerTest, twoParameters)
     // perform action
     signal(item.get(), expected_role);
 }
+
+//! Clients remove themselves and others, and connect new clients, while notification is running.
+//! Removed clients shouldn't be notified anymore, new clients are notified in the same run.
+
+TEST_F(CallbackContainerTest, removeClientDuringNotification)
+{
+    Signal<Callbacks::item_t> signal;
+    int client1{0}, client2{0}, client3{0};
+    std::vector<int> calls;
+
+    signal.connect(
+        [&](SessionItem*) {
+            calls.push_back(1);
+            signal.remove_client(&client1);
+            signal.remove_client(&client2);
+            signal.connect([&](SessionItem*) { calls.push_back(3); }, &client3);
+        },
+        &client1);
+    signal.connect([&](SessionItem*) { calls.push_back(2); }, &client2);
+
+    signal(nullptr);
+    EXPECT_EQ(calls, std::vector<int>({1, 3}));
+
+    calls.clear();
+    signal(nullptr);
+    EXPECT_EQ(calls, std::vector<int>({3}));
+}
+
+//! Connecting and removing many clients. Remaining clients are notified in order of connection.
+
+TEST_F(CallbackContainerTest, removeManyClients)
+{
+    Signal<Callbacks::item_t> signal;
+    const int n_clients = 1000;
+    std::vector<int> clients(n_clients);
+    std::vector<int> calls;
+
+    for (int i = 0; i < n_clients; ++i)
+        signal.connect([&calls, i](SessionItem*) { calls.push_back(i); }, &clients[i]);
+
+    for (int i = 0; i < n_clients; ++i)
+        if (i % 100 != 0)
+            signal.remove_client(&clients[i]);
+
+    signal(nullptr);
+    std::vector<int> expected;
+    for (int i = 0; i < n_clients; i += 100)
+        expected.push_back(i);
+    EXPECT_EQ(calls, expected);
+}
+
+//! Callback throws during notification. Container stays usable afterwards.
+
+TEST_F(CallbackContainerTest, throwingCallback)
+{
+    Signal<Callbacks::item_t> signal;
+    int client1{0}, client2{0};
+    std::vector<int> calls;
+
+    signal.connect([](SessionItem*) { throw std::runtime_error("error"); }, &client1);
+    signal.connect([&](SessionItem*) { calls.push_back(2); }, &client2);
+
+    EXPECT_THROW(signal(nullptr), std::runtime_error);
+    EXPECT_TRUE(calls.empty());
+
+    signal.remove_client(&client1);
+    signal(nullptr);
+    EXPECT_EQ(calls, std::vector<int>({2}));
+}
@@ -80,6 +80,25 @@ TEST_F(Data1DItemTest, setContent)
     EXPECT_EQ(item.binValues(), expected_content);
 }
 
+//! Setting content via DataBuffer, reading it back without copying.
+
+TEST_F(Data1DItemTest, setContentFromBuffer)
+{
+    Data1DItem item;
+
+    DataBuffer buffer(std::vector<double>{1.0, 2.0, 3.0});
+    EXPECT_THROW(item.setContent(buffer), std::runtime_error);
+
+    item.setAxis(FixedBinAxisItem::create(3, 0.0, 3.0));
+    item.setContent(buffer);
+    EXPECT_EQ(item.binValues(), buffer.toVector());
+
+    // item and buffers share the same array
+    auto values = item.binValuesBuffer();
+    EXPECT_EQ(values.data(), buffer.data());
+    EXPECT_EQ(item.binValuesBuffer().data(), values.data());
+}
+
 //! Checking the signals when axes changed.
 
 TEST_F(Data1DItemTest, checkSignalsOnAxisChange)
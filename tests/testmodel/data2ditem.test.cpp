@@ -76,6 +76,25 @@ TEST_F(Data2DItemTest, setContent)
     EXPECT_EQ(item.content(), expected_content);
 }
 
+//! Setting content via DataBuffer, reading it back without copying.
+
+TEST_F(Data2DItemTest, setContentFromBuffer)
+{
+    Data2DItem item;
+
+    DataBuffer buffer(std::vector<double>{1.0, 2.0});
+    EXPECT_THROW(item.setContent(buffer), std::runtime_error);
+
+    item.setAxes(FixedBinAxisItem::create(1, 0.0, 5.0), FixedBinAxisItem::create(2, 0.0, 3.0));
+    item.setContent(buffer);
+    EXPECT_EQ(item.content(), buffer.toVector());
+
+    // item and buffers share the same array
+    auto values = item.contentBuffer();
+    EXPECT_EQ(values.data(), buffer.data());
+    EXPECT_EQ(item.contentBuffer().data(), values.data());
+}
+
 //! Checking the signals when axes changed.
 
 TEST_F(Data2DItemTest, checkSignalsOnAxisChange)
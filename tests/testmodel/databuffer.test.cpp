@@ -0,0 +1,89 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/databuffer.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Testing DataBuffer.
+
+class DataBufferTest : public ::testing::Test
+{
+public:
+    ~DataBufferTest();
+};
+
+DataBufferTest::~DataBufferTest() = default;
+
+//! Initial state.
+
+TEST_F(DataBufferTest, initialState)
+{
+    DataBuffer buffer;
+    EXPECT_EQ(buffer.size(), 0u);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.begin(), buffer.end());
+    EXPECT_EQ(buffer.toVector(), std::vector<double>());
+    EXPECT_TRUE(Utils::IsDoubleVectorVariant(buffer.variant()));
+}
+
+//! Construction from vector and from size.
+
+TEST_F(DataBufferTest, constructFromVector)
+{
+    std::vector<double> expected = {1.0, 2.0, 3.0};
+    DataBuffer buffer(expected);
+    EXPECT_EQ(buffer.size(), 3u);
+    EXPECT_FALSE(buffer.empty());
+    EXPECT_EQ(buffer[1], 2.0);
+    EXPECT_EQ(std::vector<double>(buffer.begin(), buffer.end()), expected);
+    EXPECT_EQ(buffer.toVector(), expected);
+
+    DataBuffer buffer2(2, 42.0);
+    EXPECT_EQ(buffer2.toVector(), std::vector<double>({42.0, 42.0}));
+}
+
+//! Construction from variant.
+
+TEST_F(DataBufferTest, constructFromVariant)
+{
+    std::vector<double> expected = {1.0, 2.0, 3.0};
+    DataBuffer buffer(QVariant::fromValue(expected));
+    EXPECT_EQ(buffer.toVector(), expected);
+
+    // invalid variant gives an empty buffer
+    DataBuffer buffer2{QVariant()};
+    EXPECT_TRUE(buffer2.empty());
+
+    // variants of other types are not allowed
+    EXPECT_THROW(DataBuffer{QVariant::fromValue(42.0)}, std::runtime_error);
+}
+
+//! Buffer shares array with the variant it was created from until modification.
+
+TEST_F(DataBufferTest, implicitSharing)
+{
+    auto variant = QVariant::fromValue(std::vector<double>({1.0, 2.0, 3.0}));
+
+    DataBuffer buffer(variant);
+    EXPECT_EQ(buffer.data(), static_cast<const std::vector<double>*>(variant.constData())->data());
+
+    DataBuffer copy = buffer;
+    EXPECT_EQ(copy.data(), buffer.data());
+
+    // modification detaches the copy, original stays intact
+    copy.mutableData()[0] = 42.0;
+    EXPECT_NE(copy.data(), buffer.data());
+    EXPECT_EQ(copy.toVector(), std::vector<double>({42.0, 2.0, 3.0}));
+    EXPECT_EQ(buffer.toVector(), std::vector<double>({1.0, 2.0, 3.0}));
+    EXPECT_EQ(variant.value<std::vector<double>>(), std::vector<double>({1.0, 2.0, 3.0}));
+}
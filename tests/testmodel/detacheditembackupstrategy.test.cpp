@@ -0,0 +1,98 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "MockWidgets.h"
+#include "google_test.h"
+#include <mvvm/model/compounditem.h>
+#include <mvvm/model/itemfactory.h>
+#include <mvvm/model/propertyitem.h>
+#include <mvvm/model/sessionmodel.h>
+#include <mvvm/serialization/detacheditembackupstrategy.h>
+#include <mvvm/standarditems/standarditemcatalogue.h>
+#include <stdexcept>
+
+using namespace ModelView;
+using ::testing::_;
+
+class DetachedItemBackupStrategyTest : public ::testing::Test
+{
+public:
+    DetachedItemBackupStrategyTest()
+        : m_factory(std::make_unique<ItemFactory>(CreateStandardItemCatalogue()))
+    {
+    }
+    ~DetachedItemBackupStrategyTest();
+
+    std::unique_ptr<DetachedItemBackupStrategy> createBackupStrategy()
+    {
+        return std::make_unique<DetachedItemBackupStrategy>(m_factory.get());
+    }
+
+    std::unique_ptr<ItemFactory> m_factory;
+};
+
+DetachedItemBackupStrategyTest::~DetachedItemBackupStrategyTest() = default;
+
+//! Keeping/restoring CompoundItem. The same item should be restored.
+
+TEST_F(DetachedItemBackupStrategyTest, keepItem)
+{
+    auto strategy = createBackupStrategy();
+
+    auto item = std::make_unique<CompoundItem>();
+    auto property = item->addProperty("thickness", 42.0);
+    auto item_ptr = item.get();
+
+    strategy->keepItem(std::move(item));
+    auto restored = strategy->restoreItem();
+    EXPECT_EQ(restored.get(), item_ptr);
+    EXPECT_EQ(restored->getItem("thickness"), property);
+
+    // kept item can be restored only once
+    EXPECT_THROW(strategy->restoreItem(), std::runtime_error);
+}
+
+//! Saving/restoring PropertyItem which stays in the ownership of the caller. Copy is restored.
+
+TEST_F(DetachedItemBackupStrategyTest, saveItem)
+{
+    auto strategy = createBackupStrategy();
+
+    PropertyItem item;
+    item.setData(42.0);
+
+    strategy->saveItem(&item);
+    auto restored = strategy->restoreItem();
+
+    EXPECT_NE(restored.get(), &item);
+    EXPECT_EQ(item.modelType(), restored->modelType());
+    EXPECT_EQ(item.identifier(), restored->identifier());
+    EXPECT_EQ(item.data<QVariant>(), restored->data<QVariant>());
+}
+
+//! Keeping item taken from the model. Listeners should be notified as if item was destroyed.
+
+TEST_F(DetachedItemBackupStrategyTest, keepItemTakenFromModel)
+{
+    SessionModel model;
+    auto item = model.insertItem<CompoundItem>();
+
+    MockWidgetForItem widget(item);
+    EXPECT_CALL(widget, onItemDestroy(item)).Times(1);
+
+    auto strategy = createBackupStrategy();
+    strategy->keepItem(std::unique_ptr<SessionItem>(model.rootItem()->takeItem({"", 0})));
+    ::testing::Mock::VerifyAndClearExpectations(&widget);
+
+    // restored item can be inserted back
+    auto restored = strategy->restoreItem();
+    EXPECT_EQ(restored.get(), item);
+    EXPECT_TRUE(model.rootItem()->insertItem(restored.release(), {"", 0}));
+    EXPECT_EQ(model.findItem(item->identifier()), item);
+}
@@ -33,6 +33,13 @@ TEST_F(FileUtilsTest, exists)
     EXPECT_FALSE(Utils::exists(std::string("abc")));
 }
 
+TEST_F(FileUtilsTest, is_directory)
+{
+    EXPECT_TRUE(Utils::is_directory(testPath()));
+    EXPECT_FALSE(Utils::is_directory(std::string()));
+    EXPECT_FALSE(Utils::is_directory(TestUtils::CreateTestFile(testPath(), "is_directory.txt")));
+}
+
 TEST_F(FileUtilsTest, create_directory)
 {
     std::string dirname = testPath() + std::string("/") + "subdir";
@@ -248,3 +248,37 @@ TEST(ItemMapperTest, onAboutToRemoveItem)
     // perform action
     model.removeItem(compound1, expected_tagrow);
 }
+
+//! Changing property of deeply nested item. Only mappers of the item's closest relatives
+//! should be notified, mappers of siblings and distant ancestors stay silent.
+
+TEST(ItemMapperTest, onDeeplyNestedPropertyChange)
+{
+    SessionModel model;
+    auto compound1 = model.insertItem<CompoundItem>();
+    compound1->registerTag(TagInfo::universalTag("tag1"), /*set_as_default*/ true);
+    auto compound2 = model.insertItem<CompoundItem>(compound1);
+    compound2->registerTag(TagInfo::universalTag("tag2"), /*set_as_default*/ true);
+    auto compound3 = model.insertItem<CompoundItem>(compound2);
+    auto sibling = model.insertItem<CompoundItem>(compound2);
+
+    compound3->addProperty("height", 42.0);
+    sibling->addProperty("height", 42.0);
+
+    MockWidgetForItem widget1(compound1);
+    MockWidgetForItem widget2(compound2);
+    MockWidgetForItem widget3(sibling);
+
+    EXPECT_CALL(widget1, onDataChange(_, _)).Times(0);
+    EXPECT_CALL(widget1, onPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget1, onChildPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget2, onDataChange(_, _)).Times(0);
+    EXPECT_CALL(widget2, onPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget2, onChildPropertyChange(compound3, "height")).Times(1);
+    EXPECT_CALL(widget3, onDataChange(_, _)).Times(0);
+    EXPECT_CALL(widget3, onPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget3, onChildPropertyChange(_, _)).Times(0);
+
+    // perform action
+    compound3->setProperty("height", 43.0);
+}
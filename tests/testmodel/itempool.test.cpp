@@ -9,6 +9,7 @@
 
 #include "google_test.h"
 #include <memory>
+#include <mvvm/core/uniqueidgenerator.h>
 #include <mvvm/model/itempool.h>
 #include <mvvm/model/sessionitem.h>
 #include <stdexcept>
@@ -50,7 +51,7 @@ TEST_F(ItemPoolTest, registerItem)
     // checking unexisting registration
     std::unique_ptr<SessionItem> item2(new SessionItem);
     EXPECT_EQ(identifier_type(), pool->key_for_item(item2.get()));
-    EXPECT_EQ(nullptr, pool->item_for_key("ABC"));
+    EXPECT_EQ(nullptr, pool->item_for_key(UniqueIdGenerator::generate()));
 
     // registering second item
     auto key2 = pool->register_item(item2.get());
@@ -109,3 +110,27 @@ TEST_F(ItemPoolTest, customKey)
 
     delete item;
 }
+
+//! Key of unregistered item can be reused by another item.
+
+TEST_F(ItemPoolTest, reuseKeyAfterDeregistration)
+{
+    ItemPool pool;
+    pool.reserve(10);
+
+    const identifier_type id("abc-cde-fgh");
+    std::unique_ptr<SessionItem> item1(new SessionItem);
+    std::unique_ptr<SessionItem> item2(new SessionItem);
+
+    pool.register_item(item1.get(), id);
+    EXPECT_EQ(item1.get(), pool.item_for_key(id));
+
+    pool.unregister_item(item1.get());
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_EQ(nullptr, pool.item_for_key(id));
+
+    pool.register_item(item2.get(), id);
+    EXPECT_EQ(item2.get(), pool.item_for_key(id));
+    EXPECT_EQ(id, pool.key_for_item(item2.get()));
+    EXPECT_EQ(identifier_type(), pool.key_for_item(item1.get()));
+}
@@ -10,11 +10,18 @@
 #include "folderbasedtest.h"
 #include "google_test.h"
 #include "test_utils.h"
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <mvvm/factories/modeldocuments.h>
+#include <mvvm/model/lazydata.h>
 #include <mvvm/model/propertyitem.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/model/taginfo.h>
+#include <mvvm/serialization/blobstorage.h>
 #include <mvvm/serialization/jsondocument.h>
+#include <mvvm/serialization/jsonvariant.h>
+#include <mvvm/utils/fileutils.h>
 #include <stdexcept>
 
 using namespace ModelView;
@@ -172,3 +179,135 @@ TEST_F(JsonDocumentTest, loadModelsInWrongOrder)
     // loading model from file
     EXPECT_THROW(document.load(fileName), std::runtime_error);
 }
+
+//! Large arrays are saved in separate binary files next to the json file.
+
+TEST_F(JsonDocumentTest, saveLoadWithBlobs)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "saveLoadWithBlobs.json");
+    auto blobDir = TestUtils::TestFileName(testDir(), "saveLoadWithBlobs.blobs");
+    Utils::remove_all(blobDir);
+
+    SessionModel model("TestModel");
+    JsonDocument document({&model}, /*use_blob_storage*/ true);
+
+    std::vector<double> values(BlobStorage::defaultThreshold, 1.0);
+    auto item = model.insertItem<PropertyItem>();
+    item->setData(values);
+    auto small_item = model.insertItem<PropertyItem>();
+    small_item->setData(std::vector<double>{1.0, 2.0});
+
+    document.save(fileName);
+    auto blobs = Utils::FindFiles(blobDir, ".bin");
+    EXPECT_EQ(blobs.size(), 1u);
+    EXPECT_LT(QFileInfo(QString::fromStdString(fileName)).size(), 10000);
+
+    // changing the array, old blob is replaced
+    values[0] = 42.0;
+    item->setData(values);
+    document.save(fileName);
+    auto new_blobs = Utils::FindFiles(blobDir, ".bin");
+    ASSERT_EQ(new_blobs.size(), 1u);
+    EXPECT_NE(new_blobs.front(), blobs.front());
+
+    // loading
+    model.clear();
+    document.load(fileName);
+    auto reco_item = model.rootItem()->getItem("", 0);
+    EXPECT_EQ(reco_item->identifier(), item->identifier());
+    auto lazy_data = reco_item->storedData().value<LazyData>();
+    EXPECT_TRUE(lazy_data.isValid());
+    EXPECT_FALSE(lazy_data.isLoaded());
+    EXPECT_EQ(reco_item->data<std::vector<double>>(), values);
+
+    // handle referring to the blob in place is saved without rewriting the blob
+    document.save(fileName);
+    EXPECT_EQ(Utils::FindFiles(blobDir, ".bin"), new_blobs);
+    EXPECT_EQ(model.rootItem()->getItem("", 1)->data<std::vector<double>>(),
+              std::vector<double>({1.0, 2.0}));
+}
+
+//! Saving under a new name makes lazy arrays refer to the blobs of the new document.
+
+TEST_F(JsonDocumentTest, saveAsWithBlobs)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "saveAsWithBlobs.json");
+    auto blobDir = TestUtils::TestFileName(testDir(), "saveAsWithBlobs.blobs");
+    auto newFileName = TestUtils::TestFileName(testDir(), "saveAsWithBlobsNew.json");
+    auto newBlobDir = TestUtils::TestFileName(testDir(), "saveAsWithBlobsNew.blobs");
+    Utils::remove_all(blobDir);
+    Utils::remove_all(newBlobDir);
+
+    SessionModel model("TestModel");
+    JsonDocument document({&model}, /*use_blob_storage*/ true);
+    const std::vector<double> values(BlobStorage::defaultThreshold, 1.0);
+    model.insertItem<PropertyItem>()->setData(values);
+    document.save(fileName);
+    model.clear();
+    document.load(fileName);
+
+    document.save(newFileName);
+    auto lazy_data = model.rootItem()->getItem("", 0)->storedData().value<LazyData>();
+    auto blobs = Utils::FindFiles(newBlobDir, ".bin");
+    ASSERT_EQ(blobs.size(), 1u);
+    EXPECT_EQ(lazy_data.fileName(), blobs.front());
+
+    // old location is not needed anymore
+    lazy_data.evict();
+    Utils::remove_all(blobDir);
+    EXPECT_EQ(model.rootItem()->getItem("", 0)->data<std::vector<double>>(), values);
+}
+
+//! Large arrays of doubles are saved in packed form only on request.
+
+TEST_F(JsonDocumentTest, saveLoadWithPackedArrays)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "saveLoadWithPackedArrays.json");
+    const std::vector<double> values(JsonVariant::defaultPackingThreshold, 1.0 / 3.0);
+
+    SessionModel model("TestModel");
+    auto item = model.insertItem<PropertyItem>();
+    item->setData(values);
+
+    auto is_packed = [&fileName]() {
+        return TestUtils::LoadJson(fileName).toJson().contains("std::vector<double>:packed");
+    };
+
+    JsonDocument({&model}).save(fileName);
+    EXPECT_FALSE(is_packed());
+
+    JsonDocument document({&model}, /*use_blob_storage*/ false, /*use_packed_arrays*/ true);
+    document.save(fileName);
+    EXPECT_TRUE(is_packed());
+
+    model.clear();
+    document.load(fileName);
+    EXPECT_EQ(model.rootItem()->getItem("", 0)->data<std::vector<double>>(), values);
+}
+
+//! Packed arrays are compressed on request, document created from the format compresses them.
+
+TEST_F(JsonDocumentTest, saveLoadWithCompressedArrays)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "saveLoadWithCompressedArrays.json");
+    const std::vector<double> values(JsonVariant::defaultPackingThreshold, 1.0 / 3.0);
+
+    SessionModel model("TestModel");
+    auto item = model.insertItem<PropertyItem>();
+    item->setData(values);
+
+    auto is_compressed = [&fileName]() {
+        return TestUtils::LoadJson(fileName).toJson().contains("zlib+base64");
+    };
+
+    CreateModelDocument({&model}, DocumentFormat::JSON_PACKED)->save(fileName);
+    EXPECT_FALSE(is_compressed());
+
+    auto document = CreateModelDocument({&model}, DocumentFormat::JSON_PACKED_COMPRESSED);
+    document->save(fileName);
+    EXPECT_TRUE(is_compressed());
+
+    model.clear();
+    document->load(fileName);
+    EXPECT_EQ(model.rootItem()->getItem("", 0)->data<std::vector<double>>(), values);
+}
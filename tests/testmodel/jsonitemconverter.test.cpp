@@ -10,6 +10,7 @@
 #include "folderbasedtest.h"
 #include "google_test.h"
 #include "test_utils.h"
+#include <QBuffer>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -18,6 +19,9 @@
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/model/taginfo.h>
 #include <mvvm/serialization/jsonitemconverter.h>
+#include <mvvm/serialization/jsonstreamreader.h>
+#include <mvvm/serialization/jsonstreamwriter.h>
+#include <stdexcept>
 
 using namespace ModelView;
 
@@ -229,3 +233,84 @@ TEST_F(JsonItemConverterTest, parentAndChildToFileAndBack)
     EXPECT_EQ(reco_child->identifier(), child->identifier());
     EXPECT_EQ(reco_child->defaultTag(), "");
 }
+
+//! Parent and child written into the stream and read back.
+
+TEST_F(JsonItemConverterTest, parentAndChildToStreamAndBack)
+{
+    auto converter = createConverter();
+    const std::string model_type(Constants::BaseType);
+
+    auto parent = std::make_unique<SessionItem>(model_type);
+    parent->setDisplayName("parent_name");
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    auto child = new SessionItem(model_type);
+    child->setDisplayName("child_name");
+    parent->insertItem(child, TagRow::append());
+
+    // writing to the stream, result should be the same as json object
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    JsonStreamWriter writer(&buffer);
+    converter->to_stream(parent.get(), writer);
+    buffer.close();
+    auto document = QJsonDocument::fromJson(buffer.data());
+    EXPECT_EQ(document.object(), converter->to_json(parent.get()));
+
+    // reading back, reader uses small chunks to check reading across the buffer boundary
+    buffer.open(QIODevice::ReadOnly);
+    JsonStreamReader reader(&buffer, 7);
+    auto reco_parent = converter->from_stream(reader);
+    EXPECT_TRUE(reader.atEnd());
+
+    // checking parent reconstruction
+    EXPECT_EQ(reco_parent->childrenCount(), 1);
+    EXPECT_EQ(reco_parent->modelType(), model_type);
+    EXPECT_EQ(reco_parent->displayName(), "parent_name");
+    EXPECT_EQ(reco_parent->identifier(), parent->identifier());
+    EXPECT_EQ(reco_parent->defaultTag(), "defaultTag");
+    EXPECT_EQ(reco_parent->model(), nullptr);
+
+    // checking child reconstruction
+    auto reco_child = reco_parent->getItem("defaultTag");
+    EXPECT_EQ(reco_child->parent(), reco_parent.get());
+    EXPECT_EQ(reco_child->childrenCount(), 0);
+    EXPECT_EQ(reco_child->modelType(), model_type);
+    EXPECT_EQ(reco_child->displayName(), "child_name");
+    EXPECT_EQ(reco_child->identifier(), child->identifier());
+    EXPECT_EQ(reco_child->defaultTag(), "");
+}
+
+//! Stream reader should understand documents written by QJsonDocument, where keys are sorted.
+
+TEST_F(JsonItemConverterTest, parentAndChildFromJsonDocumentStream)
+{
+    auto converter = createConverter();
+
+    auto parent = std::make_unique<SessionItem>();
+    parent->setDisplayName("parent_name");
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    auto child = new PropertyItem;
+    child->setData(42.0);
+    parent->insertItem(child, TagRow::append());
+
+    QBuffer buffer;
+    buffer.setData(QJsonDocument(converter->to_json(parent.get())).toJson());
+    buffer.open(QIODevice::ReadOnly);
+    JsonStreamReader reader(&buffer);
+    auto reco_parent = converter->from_stream(reader);
+
+    EXPECT_EQ(reco_parent->displayName(), "parent_name");
+    EXPECT_EQ(reco_parent->identifier(), parent->identifier());
+    auto reco_child = reco_parent->getItem("defaultTag");
+    EXPECT_EQ(reco_child->parent(), reco_parent.get());
+    EXPECT_EQ(reco_child->modelType(), child->modelType());
+    EXPECT_EQ(reco_child->data<double>(), 42.0);
+
+    // invalid item
+    buffer.close();
+    buffer.setData("{\"model\":\"SessionItem\",\"itemData\":[]}");
+    buffer.open(QIODevice::ReadOnly);
+    JsonStreamReader reader2(&buffer);
+    EXPECT_THROW(converter->from_stream(reader2), std::runtime_error);
+}
@@ -0,0 +1,104 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <QBuffer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <mvvm/serialization/jsonstreamreader.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Tests JsonStreamReader class.
+
+class JsonStreamReaderTest : public ::testing::Test
+{
+protected:
+    ~JsonStreamReaderTest();
+};
+
+JsonStreamReaderTest::~JsonStreamReaderTest() = default;
+
+//! Walking through the object with nested array.
+
+TEST_F(JsonStreamReaderTest, objectWithArray)
+{
+    QBuffer buffer;
+    buffer.setData(" { \"a\" : 1.5, \"b\" : [ true, null, \"str\" ], \"c\" : {} } ");
+    buffer.open(QIODevice::ReadOnly);
+    JsonStreamReader reader(&buffer, 3);
+
+    QString key;
+    reader.beginObject();
+
+    EXPECT_TRUE(reader.nextKey(key));
+    EXPECT_EQ(key, QString("a"));
+    EXPECT_EQ(reader.readValue().toDouble(), 1.5);
+
+    EXPECT_TRUE(reader.nextKey(key));
+    EXPECT_EQ(key, QString("b"));
+    reader.beginArray();
+    EXPECT_TRUE(reader.hasNextElement());
+    EXPECT_EQ(reader.readValue(), QJsonValue(true));
+    EXPECT_TRUE(reader.hasNextElement());
+    EXPECT_TRUE(reader.readValue().isNull());
+    EXPECT_TRUE(reader.hasNextElement());
+    EXPECT_EQ(reader.readString(), QString("str"));
+    EXPECT_FALSE(reader.hasNextElement());
+
+    EXPECT_TRUE(reader.nextKey(key));
+    EXPECT_EQ(key, QString("c"));
+    reader.skipValue();
+
+    EXPECT_FALSE(reader.nextKey(key));
+    EXPECT_TRUE(reader.atEnd());
+}
+
+//! Values read from the stream should coincide with the values parsed by QJsonDocument.
+
+TEST_F(JsonStreamReaderTest, readValue)
+{
+    QByteArray text = R"({"array":[1,-2.5e-3,1e+300,"x"],)"
+                      R"("escaped":"q\"b\\s\/n\nt\tu\u00e9\ud83d\ude00",)"
+                      R"("nested":{"empty":[],"false":false},"utf8":"\u041f")";
+    text.append(u8"Привет\"}");
+
+    QBuffer buffer;
+    buffer.setData(text);
+    buffer.open(QIODevice::ReadOnly);
+    JsonStreamReader reader(&buffer, 5);
+
+    auto value = reader.readValue();
+    EXPECT_TRUE(reader.atEnd());
+    EXPECT_EQ(value.toObject(), QJsonDocument::fromJson(text).object());
+}
+
+//! Malformed documents.
+
+TEST_F(JsonStreamReaderTest, invalidDocument)
+{
+    auto read_value = [](const QByteArray& text) {
+        QBuffer buffer;
+        buffer.setData(text);
+        buffer.open(QIODevice::ReadOnly);
+        JsonStreamReader reader(&buffer);
+        reader.readValue();
+    };
+
+    EXPECT_THROW(read_value(""), std::runtime_error);
+    EXPECT_THROW(read_value("{\"a\":1"), std::runtime_error);
+    EXPECT_THROW(read_value("[1 2]"), std::runtime_error);
+    EXPECT_THROW(read_value("\"abc"), std::runtime_error);
+    EXPECT_THROW(read_value("\"\\x\""), std::runtime_error);
+    EXPECT_THROW(read_value("tru"), std::runtime_error);
+    EXPECT_THROW(read_value("-"), std::runtime_error);
+    EXPECT_NO_THROW(read_value("[]"));
+}
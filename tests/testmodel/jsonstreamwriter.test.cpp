@@ -0,0 +1,77 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <QBuffer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <limits>
+#include <mvvm/serialization/jsonstreamwriter.h>
+
+using namespace ModelView;
+
+//! Tests JsonStreamWriter class.
+
+class JsonStreamWriterTest : public ::testing::Test
+{
+protected:
+    ~JsonStreamWriterTest();
+};
+
+JsonStreamWriterTest::~JsonStreamWriterTest() = default;
+
+//! Writing nested objects and arrays.
+
+TEST_F(JsonStreamWriterTest, objectWithArray)
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    JsonStreamWriter writer(&buffer);
+
+    writer.beginObject();
+    writer.writeKey("a");
+    writer.writeValue(42);
+    writer.writeKey("b");
+    writer.beginArray();
+    writer.writeValue(true);
+    writer.writeValue(QJsonValue());
+    writer.beginObject();
+    writer.endObject();
+    writer.endArray();
+    writer.writeKey("c");
+    writer.writeValue(QJsonObject{{"x", 1.5}});
+    writer.endObject();
+
+    EXPECT_EQ(buffer.data(), QByteArray(R"({"a":42,"b":[true,null,{}],"c":{"x":1.5}})"));
+}
+
+//! Values written by the stream should coincide with the values written by QJsonDocument.
+
+TEST_F(JsonStreamWriterTest, writeValue)
+{
+    QJsonArray array{0.1,
+                     -2.5e-3,
+                     1e+300,
+                     std::numeric_limits<double>::max(),
+                     std::numeric_limits<double>::min(),
+                     -9007199254740991.0,
+                     "q\"b\\s/n\nt\t\x01",
+                     QString::fromUtf8(u8"Привет")};
+
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    JsonStreamWriter writer(&buffer);
+    writer.beginArray();
+    for (const auto& value : array)
+        writer.writeValue(value);
+    writer.endArray();
+
+    EXPECT_EQ(QJsonDocument::fromJson(buffer.data()).array(), array);
+}
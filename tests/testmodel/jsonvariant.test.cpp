@@ -14,11 +14,13 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <mvvm/core/uniqueid.h>
 #include <mvvm/model/comboproperty.h>
 #include <mvvm/model/customvariants.h>
 #include <mvvm/model/externalproperty.h>
 #include <mvvm/serialization/jsonvariant.h>
 #include <mvvm/utils/reallimits.h>
+#include <stdexcept>
 #include <vector>
 
 using namespace ModelView;
@@ -123,6 +125,21 @@ TEST_F(JsonVariantTest, stringVariant)
     EXPECT_EQ(variant, reco_variant);
 }
 
+//! QVariant(UniqueId) is written in the same form as the string with its textual representation.
+
+TEST_F(JsonVariantTest, uniqueIdVariant)
+{
+    JsonVariant converter;
+
+    UniqueId id(0x0123456789abcdefull, 0xfedcba9876543210ull);
+    auto object = converter.get_json(QVariant::fromValue(id));
+    EXPECT_EQ(object, converter.get_json(QVariant::fromValue(id.toString())));
+
+    QVariant reco_variant = converter.get_variant(object);
+    EXPECT_TRUE(Utils::IsStdStringVariant(reco_variant));
+    EXPECT_EQ(reco_variant.value<std::string>(), id.toString());
+}
+
 //! QVariant(double) conversion.
 
 TEST_F(JsonVariantTest, doubleVariant)
@@ -171,6 +188,61 @@ TEST_F(JsonVariantTest, vectorOfDoubleVariant)
     EXPECT_EQ(variant, reco_variant);
 }
 
+//! QVariant(std::vector<double>) conversion in packed form.
+
+TEST_F(JsonVariantTest, packedVectorOfDoubleVariant)
+{
+    JsonVariant converter;
+
+    // arrays are written as json arrays by default
+    const std::vector<double> value = {42.0, 1.0 / 3.0, -1e-300};
+    auto object = converter.get_json(QVariant::fromValue(value));
+    EXPECT_TRUE(object["value"].isArray());
+
+    // all arrays are packed
+    converter.setPackingThreshold(0);
+    object = converter.get_json(QVariant::fromValue(value));
+    EXPECT_TRUE(converter.isVariant(object));
+    EXPECT_EQ(object["type"].toString(), QString("std::vector<double>:packed"));
+    auto reco_variant = converter.get_variant(object);
+    EXPECT_TRUE(Utils::IsDoubleVectorVariant(reco_variant));
+    EXPECT_EQ(reco_variant.value<std::vector<double>>(), value);
+
+    // packed and compressed
+    converter.setPackingCompression(true);
+    const std::vector<double> large_value(10000, 42.0);
+    object = converter.get_json(QVariant::fromValue(large_value));
+    EXPECT_LT(object["value"].toObject()["data"].toString().size(), 10000);
+    EXPECT_EQ(converter.get_variant(object).value<std::vector<double>>(), large_value);
+
+    // packing is disabled by default, packed arrays are still accepted
+    JsonVariant default_converter;
+    object = default_converter.get_json(QVariant::fromValue(large_value));
+    EXPECT_TRUE(object["value"].isArray());
+    EXPECT_EQ(default_converter.get_variant(object).value<std::vector<double>>(), large_value);
+
+    auto packed = converter.get_json(QVariant::fromValue(large_value));
+    EXPECT_EQ(default_converter.get_variant(packed).value<std::vector<double>>(), large_value);
+
+    converter.setPackingThreshold(-1);
+    object = converter.get_json(QVariant::fromValue(large_value));
+    EXPECT_TRUE(object["value"].isArray());
+
+    // corrupted data
+    auto corrupted = packed;
+    auto json_data = corrupted["value"].toObject();
+    json_data["size"] = 42;
+    corrupted["value"] = json_data;
+    EXPECT_THROW(default_converter.get_variant(corrupted), std::runtime_error);
+
+    // invalid size
+    for (auto size : {QJsonValue(-1.0), QJsonValue(1.5), QJsonValue(1e300), QJsonValue("42")}) {
+        json_data["size"] = size;
+        corrupted["value"] = json_data;
+        EXPECT_THROW(default_converter.get_variant(corrupted), std::runtime_error);
+    }
+}
+
 //! QVariant(ComboProperty) conversion.
 
 TEST_F(JsonVariantTest, comboPropertyVariant)
@@ -0,0 +1,173 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "folderbasedtest.h"
+#include "google_test.h"
+#include "test_utils.h"
+#include <QDataStream>
+#include <QFile>
+#include <mvvm/model/customvariants.h>
+#include <mvvm/model/lazydata.h>
+#include <mvvm/model/sessionitem.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Tests LazyData class.
+
+class LazyDataTest : public FolderBasedTest
+{
+public:
+    LazyDataTest() : FolderBasedTest("test_LazyData") {}
+    ~LazyDataTest();
+
+    //! Writes file with 8 bytes header followed by given values.
+    std::string createDataFile(const std::string& name, const std::vector<double>& values)
+    {
+        auto file_name = TestUtils::TestFileName(testDir(), name);
+        QFile file(QString::fromStdString(file_name));
+        file.open(QIODevice::WriteOnly);
+        QDataStream stream(&file);
+        stream.setByteOrder(QDataStream::LittleEndian);
+        stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
+        stream.writeRawData("HEADER!!", 8);
+        for (auto x : values)
+            stream << x;
+        return file_name;
+    }
+};
+
+LazyDataTest::~LazyDataTest() = default;
+
+TEST_F(LazyDataTest, initialState)
+{
+    LazyData data;
+    EXPECT_FALSE(data.isValid());
+    EXPECT_FALSE(data.isLoaded());
+    EXPECT_EQ(data.size(), 0u);
+    EXPECT_FALSE(data.variant().isValid());
+}
+
+//! Array is read on first access and shared between copies of the handle.
+
+TEST_F(LazyDataTest, variant)
+{
+    const std::vector<double> values = {1.0, 2.0, 3.0};
+    auto file_name = createDataFile("variant.bin", values);
+
+    LazyData data(file_name, 8, values.size());
+    EXPECT_TRUE(data.isValid());
+    EXPECT_FALSE(data.isLoaded());
+    EXPECT_TRUE(LazyData::isFileInUse(file_name));
+
+    auto copy = data;
+    EXPECT_EQ(copy, data);
+    EXPECT_EQ(data.variant().value<std::vector<double>>(), values);
+    EXPECT_TRUE(data.isLoaded());
+    EXPECT_TRUE(copy.isLoaded());
+
+    copy.evict();
+    EXPECT_FALSE(data.isLoaded());
+    EXPECT_EQ(data.read(), values);
+    EXPECT_FALSE(data.isLoaded());
+
+    // file is too short
+    LazyData wrong(file_name, 8, values.size() + 1);
+    EXPECT_THROW(wrong.variant(), std::runtime_error);
+    EXPECT_FALSE(wrong.isLoaded());
+}
+
+//! Relocated handle and all its copies read the array from the new file.
+
+TEST_F(LazyDataTest, relocate)
+{
+    const std::vector<double> values = {1.0, 2.0, 3.0};
+    auto file_name = createDataFile("relocate.bin", values);
+    auto new_file_name = createDataFile("relocate_new.bin", {4.0, 5.0, 6.0});
+
+    LazyData data(file_name, 8, values.size());
+    auto copy = data;
+    data.relocate(new_file_name, 8);
+    EXPECT_EQ(copy.fileName(), new_file_name);
+    EXPECT_EQ(copy.offset(), 8);
+    EXPECT_FALSE(LazyData::isFileInUse(file_name));
+    EXPECT_TRUE(LazyData::isFileInUse(new_file_name));
+    EXPECT_EQ(copy.variant().value<std::vector<double>>(), std::vector<double>({4.0, 5.0, 6.0}));
+}
+
+//! Least recently used arrays are evicted when the memory limit is exceeded.
+
+TEST_F(LazyDataTest, memoryLimit)
+{
+    auto file_name = createDataFile("memoryLimit.bin", std::vector<double>(100, 1.0));
+    const auto old_limit = LazyData::memoryLimit();
+
+    LazyData data1(file_name, 8, 50);
+    LazyData data2(file_name, 8, 50);
+    data1.variant();
+    data2.variant();
+    EXPECT_TRUE(data1.isLoaded());
+    EXPECT_TRUE(data2.isLoaded());
+
+    // only one array fits, the first one is the coldest
+    LazyData::setMemoryLimit(60 * sizeof(double));
+    EXPECT_FALSE(data1.isLoaded());
+    EXPECT_TRUE(data2.isLoaded());
+
+    data1.variant();
+    EXPECT_TRUE(data1.isLoaded());
+    EXPECT_FALSE(data2.isLoaded());
+
+    LazyData::setMemoryLimit(old_limit);
+}
+
+//! SessionItem returns the content of LazyData as std::vector<double>.
+
+TEST_F(LazyDataTest, itemData)
+{
+    const std::vector<double> values = {1.0, 2.0, 3.0};
+    auto file_name = createDataFile("itemData.bin", values);
+
+    SessionItem item;
+    LazyData data(file_name, 8, values.size());
+    item.setData(data);
+    EXPECT_TRUE(Utils::IsLazyDataVariant(item.storedData()));
+    EXPECT_FALSE(data.isLoaded());
+
+    EXPECT_EQ(item.data<std::vector<double>>(), values);
+    EXPECT_TRUE(data.isLoaded());
+
+    // array can replace the handle
+    const std::vector<double> new_values = {4.0, 5.0};
+    EXPECT_TRUE(item.setData(new_values));
+    EXPECT_EQ(item.data<std::vector<double>>(), new_values);
+    EXPECT_FALSE(Utils::IsLazyDataVariant(item.storedData()));
+
+    // other types are still not allowed
+    EXPECT_THROW(item.setData(42.0), std::runtime_error);
+}
+
+//! SessionItem returns array of zeros, if the file behind LazyData can't be read.
+
+TEST_F(LazyDataTest, unreadableItemData)
+{
+    const std::vector<double> values = {1.0, 2.0, 3.0};
+    auto file_name = createDataFile("unreadableItemData.bin", values);
+
+    SessionItem item;
+    LazyData data(TestUtils::TestFileName(testDir(), "nonExisting.bin"), 8, values.size());
+    item.setData(data);
+    EXPECT_NO_THROW(item.data<std::vector<double>>());
+    EXPECT_EQ(item.data<std::vector<double>>(), std::vector<double>(values.size(), 0.0));
+    EXPECT_TRUE(Utils::IsLazyDataVariant(item.storedData()));
+
+    // read is retried on the next access
+    data.relocate(file_name, 8);
+    EXPECT_EQ(item.data<std::vector<double>>(), values);
+}
@@ -11,8 +11,10 @@
 #include "google_test.h"
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
+#include <mvvm/model/taginfo.h>
 #include <mvvm/model/tagrow.h>
 #include <mvvm/signals/modelmapper.h>
+#include <stdexcept>
 
 using namespace ModelView;
 using ::testing::_;
@@ -223,3 +225,122 @@ TEST(ModelMapperTest, onClearRebuild)
     auto rebuild = [](auto item) { item->insertItem(new SessionItem, TagRow::append()); };
     model->clear(rebuild);
 }
+
+//! Changing data of items during the batch. Single notification per (item, role) is expected
+//! at the end of the batch.
+
+TEST(ModelMapperTest, onDataChangeBatch)
+{
+    SessionModel model;
+    MockWidgetForModel widget(&model);
+
+    EXPECT_CALL(widget, onItemInserted(_, _)).Times(2);
+    auto item1 = model.insertItem<SessionItem>(model.rootItem());
+    auto item2 = model.insertItem<SessionItem>(model.rootItem());
+
+    const int role = ItemDataRole::DATA;
+    {
+        ModelMapper::BatchGuard guard(model.mapper());
+        EXPECT_TRUE(model.mapper()->isBatchActive());
+
+        // nothing should be emitted during the batch
+        EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
+        model.setData(item1, 42.0, role);
+        model.setData(item2, 42.0, role);
+        model.setData(item1, 43.0, role);
+        model.setData(item1, 44.0, role);
+        ::testing::Mock::VerifyAndClearExpectations(&widget);
+
+        // single notification per item is emitted at the end
+        EXPECT_CALL(widget, onDataChange(item1, role)).Times(1);
+        EXPECT_CALL(widget, onDataChange(item2, role)).Times(1);
+        EXPECT_CALL(widget, onItemInserted(_, _)).Times(0);
+        EXPECT_CALL(widget, onItemRemoved(_, _)).Times(0);
+        EXPECT_CALL(widget, onAboutToRemoveItem(_, _)).Times(0);
+    }
+    EXPECT_FALSE(model.mapper()->isBatchActive());
+}
+
+//! Nested batches. Notifications are emitted when outermost batch ends.
+
+TEST(ModelMapperTest, onDataChangeNestedBatch)
+{
+    SessionModel model;
+    MockWidgetForModel widget(&model);
+
+    EXPECT_CALL(widget, onItemInserted(_, _)).Times(1);
+    auto item = model.insertItem<SessionItem>(model.rootItem());
+
+    EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
+    model.mapper()->beginBatch();
+    model.mapper()->beginBatch();
+    model.setData(item, 42.0, ItemDataRole::DATA);
+    model.mapper()->endBatch();
+    model.setData(item, 43.0, ItemDataRole::DATA);
+    ::testing::Mock::VerifyAndClearExpectations(&widget);
+
+    EXPECT_CALL(widget, onDataChange(item, ItemDataRole::DATA)).Times(1);
+    model.mapper()->endBatch();
+
+    EXPECT_THROW(model.mapper()->endBatch(), std::runtime_error);
+}
+
+//! Changing data of items and removing them during the batch. Structural notifications are
+//! emitted immediately, data change notifications for removed items are dropped.
+
+TEST(ModelMapperTest, onItemRemovedBatch)
+{
+    SessionModel model;
+    MockWidgetForModel widget(&model);
+
+    const TagRow expected_tagrow{model.rootItem()->defaultTag(), 0};
+    EXPECT_CALL(widget, onItemInserted(_, _)).Times(2);
+    auto item1 = model.insertItem<SessionItem>(model.rootItem());
+    auto item2 = model.insertItem<SessionItem>(model.rootItem());
+
+    const int role = ItemDataRole::DATA;
+    {
+        ModelMapper::BatchGuard guard(model.mapper());
+
+        EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
+        EXPECT_CALL(widget, onAboutToRemoveItem(model.rootItem(), expected_tagrow)).Times(1);
+        EXPECT_CALL(widget, onItemRemoved(model.rootItem(), expected_tagrow)).Times(1);
+        model.setData(item1, 42.0, role);
+        model.setData(item2, 42.0, role);
+        model.removeItem(model.rootItem(), expected_tagrow);
+        ::testing::Mock::VerifyAndClearExpectations(&widget);
+
+        EXPECT_CALL(widget, onDataChange(item1, _)).Times(0);
+        EXPECT_CALL(widget, onDataChange(item2, role)).Times(1);
+    }
+}
+
+//! Changing data of the item and moving it during the batch. Moved item stays in the model, so
+//! its data change notification is emitted at the end of the batch.
+
+TEST(ModelMapperTest, onItemMovedBatch)
+{
+    SessionModel model;
+    MockWidgetForModel widget(&model);
+
+    EXPECT_CALL(widget, onItemInserted(_, _)).Times(2);
+    auto parent = model.insertItem<SessionItem>(model.rootItem());
+    parent->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+    auto item = model.insertItem<SessionItem>(model.rootItem());
+
+    const int role = ItemDataRole::DATA;
+    {
+        ModelMapper::BatchGuard guard(model.mapper());
+
+        EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
+        EXPECT_CALL(widget, onAboutToRemoveItem(_, _)).Times(1);
+        EXPECT_CALL(widget, onItemRemoved(_, _)).Times(1);
+        EXPECT_CALL(widget, onItemInserted(parent, TagRow{"tag", 0})).Times(1);
+        model.setData(item, 42.0, role);
+        model.moveItem(item, parent, {"tag", 0});
+        ::testing::Mock::VerifyAndClearExpectations(&widget);
+
+        EXPECT_CALL(widget, onDataChange(item, role)).Times(1);
+    }
+    EXPECT_EQ(item->parent(), parent);
+}
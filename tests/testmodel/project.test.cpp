@@ -11,11 +11,15 @@
 #include "google_test.h"
 #include "test_utils.h"
 #include <cctype>
+#include <fstream>
+#include <iterator>
 #include <mvvm/interfaces/applicationmodelsinterface.h>
 #include <mvvm/model/propertyitem.h>
 #include <mvvm/model/sessionmodel.h>
 #include <mvvm/project/project.h>
+#include <mvvm/project/projectarchive.h>
 #include <mvvm/utils/fileutils.h>
+#include <stdexcept>
 
 using namespace ModelView;
 
@@ -134,3 +138,179 @@ TEST_F(ProjectTest, loadModel)
     EXPECT_EQ(project.projectDir(), project_dir);
     EXPECT_FALSE(project.isModified());
 }
+
+//! Models can be saved in binary format, if application requests it.
+
+TEST_F(ProjectTest, saveLoadBinaryModel)
+{
+    class BinaryApplicationModels : public ApplicationModels
+    {
+    public:
+        DocumentFormat document_format(const SessionModel& model) const override
+        {
+            return &model == material_model.get() ? DocumentFormat::BINARY : DocumentFormat::JSON;
+        }
+    };
+
+    BinaryApplicationModels models;
+    Project project(&models);
+
+    auto item = models.material_model->insertItem<PropertyItem>();
+    item->setData(std::vector<double>{1.0, 2.0});
+    auto item_identifier = item->identifier();
+
+    auto project_dir = createEmptyDir("Untitled3");
+    project.save(project_dir);
+
+    EXPECT_TRUE(Utils::exists(Utils::join(project_dir, get_json_filename(samplemodel_name))));
+    EXPECT_FALSE(Utils::exists(Utils::join(project_dir, get_json_filename(materialmodel_name))));
+    EXPECT_TRUE(Utils::exists(Utils::join(project_dir, "materialmodel.mvb")));
+
+    models.material_model->clear();
+    project.load(project_dir);
+
+    auto reco_item = models.material_model->rootItem()->children()[0];
+    EXPECT_EQ(reco_item->identifier(), item_identifier);
+    EXPECT_EQ(reco_item->data<std::vector<double>>(), std::vector<double>({1.0, 2.0}));
+}
+
+//! Models are loaded only if all files were successfully read.
+
+TEST_F(ProjectTest, loadWithCorruptedFile)
+{
+    ApplicationModels models;
+    Project project(&models);
+
+    models.sample_model->insertItem<PropertyItem>();
+    models.material_model->insertItem<PropertyItem>();
+
+    auto project_dir = createEmptyDir("Untitled4");
+    project.save(project_dir);
+
+    // corrupting one of the files
+    auto material_json = Utils::join(project_dir, get_json_filename(materialmodel_name));
+    std::ofstream(material_json) << "[{\"model\":\"MaterialModel\",\"items\":[";
+
+    models.sample_model->clear();
+    models.material_model->clear();
+
+    EXPECT_THROW(project.load(project_dir), std::runtime_error);
+    EXPECT_EQ(models.sample_model->rootItem()->childrenCount(), 0);
+    EXPECT_EQ(models.material_model->rootItem()->childrenCount(), 0);
+}
+
+//! Saving into the same directory again rewrites only changed models.
+
+TEST_F(ProjectTest, saveChangedModelsOnly)
+{
+    ApplicationModels models;
+    Project project(&models);
+
+    auto project_dir = createEmptyDir("Untitled5");
+    project.save(project_dir);
+
+    // replacing content of both files with marker
+    auto sample_json = Utils::join(project_dir, get_json_filename(samplemodel_name));
+    auto material_json = Utils::join(project_dir, get_json_filename(materialmodel_name));
+    const std::string marker("marker");
+    std::ofstream(sample_json) << marker;
+    std::ofstream(material_json) << marker;
+
+    auto read_file = [](const std::string& file_name) {
+        std::ifstream stream(file_name);
+        return std::string(std::istreambuf_iterator<char>(stream), {});
+    };
+
+    // only the sample model is changed and saved
+    models.sample_model->insertItem<PropertyItem>();
+    project.save(project_dir);
+    EXPECT_NE(read_file(sample_json), marker);
+    EXPECT_EQ(read_file(material_json), marker);
+    EXPECT_FALSE(project.isModified());
+
+    // saving to another directory writes all models
+    auto project_dir2 = createEmptyDir("Untitled6");
+    project.save(project_dir2);
+    EXPECT_TRUE(Utils::exists(Utils::join(project_dir2, get_json_filename(samplemodel_name))));
+    EXPECT_TRUE(Utils::exists(Utils::join(project_dir2, get_json_filename(materialmodel_name))));
+}
+
+//! Saving and loading all models using single archive file.
+
+TEST_F(ProjectTest, saveLoadArchive)
+{
+    ApplicationModels models;
+    Project project(&models);
+
+    auto item0 = models.sample_model->insertItem<PropertyItem>();
+    item0->setData(std::vector<double>(100000, 1.0));
+    auto item0_identifier = item0->identifier();
+    auto item1 = models.material_model->insertItem<PropertyItem>();
+    item1->setData(std::string("material_model_item"));
+
+    auto file_name = Utils::join(createEmptyDir("Untitled7"), "project.mvpa");
+    EXPECT_TRUE(project.saveArchive(file_name));
+    EXPECT_EQ(project.projectDir(), file_name);
+    EXPECT_FALSE(project.isModified());
+    EXPECT_FALSE(project.saveArchive(Utils::join(testDir(), "missing/project.mvpa")));
+
+    // single model can be read from the archive
+    ProjectArchive archive(file_name);
+    const std::vector<std::string> expected_names = {get_json_filename(samplemodel_name),
+                                                     get_json_filename(materialmodel_name)};
+    EXPECT_EQ(archive.entryNames(), expected_names);
+    EXPECT_NE(archive.read(get_json_filename(materialmodel_name)).indexOf("material_model_item"),
+              -1);
+
+    models.sample_model->clear();
+    models.material_model->clear();
+    EXPECT_TRUE(project.loadArchive(file_name));
+    EXPECT_FALSE(project.isModified());
+    EXPECT_FALSE(project.loadArchive(Utils::join(testDir(), "missing.mvpa")));
+
+    auto reco_item = models.sample_model->rootItem()->children()[0];
+    EXPECT_EQ(reco_item->identifier(), item0_identifier);
+    EXPECT_EQ(reco_item->data<std::vector<double>>(), std::vector<double>(100000, 1.0));
+    EXPECT_EQ(models.material_model->rootItem()->childrenCount(), 1);
+
+    // saving again into the same archive keeps unchanged model
+    auto material_entry = archive.readCompressed(get_json_filename(materialmodel_name));
+    models.sample_model->clear();
+    EXPECT_TRUE(project.saveArchive(file_name));
+    EXPECT_EQ(archive.readCompressed(get_json_filename(materialmodel_name)).compressed_data,
+              material_entry.compressed_data);
+
+    models.material_model->clear();
+    EXPECT_TRUE(project.loadArchive(file_name));
+    EXPECT_EQ(models.sample_model->rootItem()->childrenCount(), 0);
+    EXPECT_EQ(models.material_model->rootItem()->childrenCount(), 1);
+}
+
+//! Archive file can't be used as a project directory and vice versa.
+
+TEST_F(ProjectTest, archiveAndDirectory)
+{
+    ApplicationModels models;
+    Project project(&models);
+    models.sample_model->insertItem<PropertyItem>();
+
+    auto project_dir = createEmptyDir("Untitled8");
+    auto file_name = Utils::join(project_dir, "project.mvpa");
+    EXPECT_TRUE(project.saveArchive(file_name));
+
+    // archive is not a directory
+    EXPECT_FALSE(project.save(project.projectDir()));
+    EXPECT_FALSE(project.load(project.projectDir()));
+    EXPECT_EQ(project.projectDir(), file_name);
+
+    // saving into directory after archive writes all models
+    EXPECT_TRUE(project.save(project_dir));
+    EXPECT_EQ(project.projectDir(), project_dir);
+    EXPECT_TRUE(Utils::exists(Utils::join(project_dir, get_json_filename(samplemodel_name))));
+    EXPECT_TRUE(Utils::exists(Utils::join(project_dir, get_json_filename(materialmodel_name))));
+
+    // archive saved after directory is written from scratch
+    EXPECT_TRUE(project.saveArchive(file_name));
+    EXPECT_EQ(project.projectDir(), file_name);
+    EXPECT_EQ(ProjectArchive(file_name).entryNames().size(), 2u);
+}
@@ -0,0 +1,92 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "folderbasedtest.h"
+#include "google_test.h"
+#include <fstream>
+#include <mvvm/project/projectarchive.h>
+#include <mvvm/utils/fileutils.h>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Tests ProjectArchive class.
+
+class ProjectArchiveTest : public FolderBasedTest
+{
+public:
+    ProjectArchiveTest() : FolderBasedTest("test_ProjectArchive") {}
+    ~ProjectArchiveTest();
+};
+
+ProjectArchiveTest::~ProjectArchiveTest() = default;
+
+TEST_F(ProjectArchiveTest, compress)
+{
+    const QByteArray data(1000, 'a');
+    auto entry = ProjectArchive::compress("abc", data);
+    EXPECT_EQ(entry.name, std::string("abc"));
+    EXPECT_EQ(entry.size, 1000u);
+    EXPECT_LT(entry.compressed_data.size(), data.size());
+}
+
+//! Writing entries and reading them back one by one.
+
+TEST_F(ProjectArchiveTest, writeAndRead)
+{
+    auto file_name = Utils::join(testDir(), "writeAndRead.mvpa");
+    ProjectArchive archive(file_name);
+    EXPECT_EQ(archive.fileName(), file_name);
+
+    const QByteArray data1(10000, 'a');
+    const QByteArray data2("{\"model\":\"SampleModel\"}");
+    archive.write({ProjectArchive::compress("model1.json", data1),
+                   ProjectArchive::compress("model2.mvb", data2),
+                   ProjectArchive::compress("empty", QByteArray())});
+
+    EXPECT_TRUE(Utils::exists(file_name));
+    EXPECT_EQ(archive.entryNames(),
+              std::vector<std::string>({"model1.json", "model2.mvb", "empty"}));
+    EXPECT_TRUE(archive.hasEntry("model2.mvb"));
+    EXPECT_FALSE(archive.hasEntry("model3.json"));
+
+    EXPECT_EQ(archive.read("model2.mvb"), data2);
+    EXPECT_EQ(archive.read("model1.json"), data1);
+    EXPECT_TRUE(archive.read("empty").isEmpty());
+    EXPECT_THROW(archive.read("model3.json"), std::runtime_error);
+
+    // compressed entry can be written into another archive as it is
+    auto entry = archive.readCompressed("model1.json");
+    EXPECT_EQ(entry.size, 10000u);
+    ProjectArchive archive2(Utils::join(testDir(), "writeAndRead2.mvpa"));
+    archive2.write({entry});
+    EXPECT_EQ(archive2.read("model1.json"), data1);
+
+    // rewriting the archive replaces its content
+    archive.write({ProjectArchive::compress("model2.mvb", data1)});
+    EXPECT_EQ(archive.entryNames(), std::vector<std::string>({"model2.mvb"}));
+    EXPECT_EQ(archive.read("model2.mvb"), data1);
+}
+
+//! Invalid archives and duplicated entries.
+
+TEST_F(ProjectArchiveTest, invalidArchive)
+{
+    ProjectArchive missing(Utils::join(testDir(), "missing.mvpa"));
+    EXPECT_THROW(missing.entryNames(), std::runtime_error);
+
+    auto file_name = Utils::join(testDir(), "invalidArchive.mvpa");
+    std::ofstream(file_name) << "[{\"model\":\"SampleModel\",\"items\":[]}]";
+    ProjectArchive archive(file_name);
+    EXPECT_THROW(archive.entryNames(), std::runtime_error);
+    EXPECT_THROW(archive.read("abc"), std::runtime_error);
+
+    auto entry = ProjectArchive::compress("abc", QByteArray("abc"));
+    EXPECT_THROW(archive.write({entry, entry}), std::runtime_error);
+}
@@ -75,3 +75,26 @@ TEST_F(ProjectChangeControllerTest, callback)
     controller.resetChanged();
     EXPECT_FALSE(controller.hasChanged());
 }
+
+TEST_F(ProjectChangeControllerTest, changedModel)
+{
+    SessionModel sample_model("SampleModel");
+    SessionModel material_model("MaterialModel");
+    std::vector<SessionModel*> models = {&sample_model, &material_model};
+
+    ProjectChangedController controller(models);
+    EXPECT_FALSE(controller.hasChanged(&sample_model));
+    EXPECT_FALSE(controller.hasChanged(&material_model));
+
+    sample_model.insertItem<PropertyItem>();
+    EXPECT_TRUE(controller.hasChanged(&sample_model));
+    EXPECT_FALSE(controller.hasChanged(&material_model));
+
+    controller.resetChanged();
+    EXPECT_FALSE(controller.hasChanged(&sample_model));
+    EXPECT_FALSE(controller.hasChanged(&material_model));
+
+    // unknown model is always changed
+    SessionModel other_model("OtherModel");
+    EXPECT_TRUE(controller.hasChanged(&other_model));
+}
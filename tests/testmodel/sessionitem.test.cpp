@@ -44,7 +44,7 @@ TEST_F(SessionItemTest, initialState)
     EXPECT_EQ(item.roles(), expected_roles);
 
     // Identifier is not zero
-    EXPECT_FALSE(item.identifier().empty());
+    EXPECT_NE(item.identifier(), identifier_type());
 }
 
 TEST_F(SessionItemTest, modelType)
@@ -412,6 +412,14 @@ TEST_F(SessionItemTest, twoTagsAndItems)
     EXPECT_EQ(parent->children(), expected);
     EXPECT_EQ(Utils::IndexOfChild(parent.get(), child_t1_a), 0);
     EXPECT_EQ(Utils::IndexOfChild(parent.get(), child_t2_c), 4);
+    EXPECT_EQ(parent->childrenCount(), 5);
+    for (int index = 0; index < 5; ++index) {
+        EXPECT_EQ(parent->childAt(index), expected[static_cast<size_t>(index)]);
+        EXPECT_EQ(parent->indexOfChild(expected[static_cast<size_t>(index)]), index);
+    }
+    EXPECT_EQ(parent->childAt(-1), nullptr);
+    EXPECT_EQ(parent->childAt(5), nullptr);
+    EXPECT_EQ(parent->indexOfChild(parent.get()), -1);
 
     // testing single item access via tag interface
     EXPECT_EQ(parent->getItem(tag1), child_t1_a);
@@ -434,6 +442,8 @@ TEST_F(SessionItemTest, twoTagsAndItems)
     EXPECT_EQ(parent->getItems(tag1), expected);
     expected = {child_t2_a, child_t2_c};
     EXPECT_EQ(parent->getItems(tag2), expected);
+    EXPECT_EQ(parent->indexOfChild(child_t2_c), 3);
+    EXPECT_EQ(parent->tagRowOfItem(child_t2_c), TagRow(tag2, 1));
 }
 
 //! Inserting and removing items when tag has limits.
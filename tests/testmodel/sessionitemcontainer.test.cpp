@@ -149,6 +149,38 @@ TEST_F(SessionItemContainerTest, indexOfItem)
     EXPECT_EQ(tag.indexOfItem(child3.get()), -1);
 }
 
+//! Checking ::indexOfItem while items are inserted and taken in the middle of the container.
+
+TEST_F(SessionItemContainerTest, indexOfItemAfterInsertAndTake)
+{
+    const std::string model_type("model_a");
+
+    SessionItemContainer tag(TagInfo::universalTag("tag"));
+    SessionItemContainer tag2(TagInfo::universalTag("tag2"));
+
+    SessionItem* child1 = new SessionItem(model_type);
+    SessionItem* child2 = new SessionItem(model_type);
+    SessionItem* child3 = new SessionItem(model_type);
+    EXPECT_TRUE(tag.insertItem(child1, 0));
+    EXPECT_TRUE(tag.insertItem(child3, 1));
+    EXPECT_TRUE(tag.insertItem(child2, 1)); // between child1 and child3
+    EXPECT_EQ(tag.indexOfItem(child1), 0);
+    EXPECT_EQ(tag.indexOfItem(child2), 1);
+    EXPECT_EQ(tag.indexOfItem(child3), 2);
+
+    // taking first item shifts remaining
+    auto taken = tag.takeItem(0);
+    EXPECT_EQ(taken, child1);
+    EXPECT_EQ(tag.indexOfItem(child1), -1);
+    EXPECT_EQ(tag.indexOfItem(child2), 0);
+    EXPECT_EQ(tag.indexOfItem(child3), 1);
+
+    // item inserted in another container doesn't belong to the first one
+    EXPECT_TRUE(tag2.insertItem(taken, 0));
+    EXPECT_EQ(tag.indexOfItem(child1), -1);
+    EXPECT_EQ(tag2.indexOfItem(child1), 0);
+}
+
 //! Checking ::itemAt.
 
 TEST_F(SessionItemContainerTest, itemAt)
@@ -165,3 +165,51 @@ TEST_F(SessionItemDataTest, hasRole)
     data.setData(QVariant(), role);
     EXPECT_FALSE(data.hasData(role));
 }
+
+//! Removal of role keeps the order of remaining roles and their data.
+
+TEST_F(SessionItemDataTest, removeRole)
+{
+    SessionItemData data;
+
+    const int custom_role = 99;
+    data.setData(QVariant::fromValue(std::string("id")), ItemDataRole::IDENTIFIER);
+    data.setData(QVariant::fromValue(1), custom_role);
+    data.setData(QVariant::fromValue(std::string("name")), ItemDataRole::DISPLAY);
+    data.setData(QVariant::fromValue(42.0), ItemDataRole::DATA);
+
+    std::vector<int> expected{ItemDataRole::IDENTIFIER, custom_role, ItemDataRole::DISPLAY,
+                              ItemDataRole::DATA};
+    EXPECT_EQ(data.roles(), expected);
+
+    // removing role in the middle
+    EXPECT_TRUE(data.setData(QVariant(), custom_role));
+    expected = {ItemDataRole::IDENTIFIER, ItemDataRole::DISPLAY, ItemDataRole::DATA};
+    EXPECT_EQ(data.roles(), expected);
+    EXPECT_FALSE(data.hasData(custom_role));
+    EXPECT_EQ(data.data(ItemDataRole::DISPLAY).value<std::string>(), std::string("name"));
+    EXPECT_EQ(data.data(ItemDataRole::DATA).value<double>(), 42.0);
+
+    // removing first role
+    EXPECT_TRUE(data.setData(QVariant(), ItemDataRole::IDENTIFIER));
+    expected = {ItemDataRole::DISPLAY, ItemDataRole::DATA};
+    EXPECT_EQ(data.roles(), expected);
+    EXPECT_FALSE(data.hasData(ItemDataRole::IDENTIFIER));
+    EXPECT_EQ(data.data(ItemDataRole::DATA).value<double>(), 42.0);
+
+    // adding role again puts it at the end
+    EXPECT_TRUE(data.setData(QVariant::fromValue(2), custom_role));
+    expected = {ItemDataRole::DISPLAY, ItemDataRole::DATA, custom_role};
+    EXPECT_EQ(data.roles(), expected);
+    EXPECT_EQ(data.data(custom_role).value<int>(), 2);
+}
+
+//! QString based variants are not allowed.
+
+TEST_F(SessionItemDataTest, qstringVariant)
+{
+    SessionItemData data;
+    EXPECT_THROW(data.setData(QVariant(QString("abc")), ItemDataRole::DATA), std::runtime_error);
+    EXPECT_THROW(data.setData(QVariant(QString("abc")), 99), std::runtime_error);
+    EXPECT_TRUE(data.roles().empty());
+}
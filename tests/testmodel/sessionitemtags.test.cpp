@@ -216,3 +216,55 @@ TEST_F(SessionItemTagsTest, isSinglePropertyTag)
 
     EXPECT_FALSE(tag.isSinglePropertyTag("unexisting tag"));
 }
+
+//! Access to items when many tags are registered. Iteration follows the order of registration.
+
+TEST_F(SessionItemTagsTest, manyTags)
+{
+    SessionItemTags tag;
+    const int n_tags = 40;
+    std::vector<SessionItem*> expected;
+    for (int i = 0; i < n_tags; ++i) {
+        auto name = "tag" + std::to_string(i);
+        tag.registerTag(TagInfo::universalTag(name), /*set_as_default*/ i == n_tags / 2);
+        auto item = new SessionItem;
+        tag.insertItem(item, TagRow::append(name));
+        expected.push_back(item);
+    }
+
+    EXPECT_EQ(tag.defaultTag(), "tag20");
+    EXPECT_EQ(tag.allitems(), expected);
+    for (int i = 0; i < n_tags; ++i) {
+        auto name = "tag" + std::to_string(i);
+        EXPECT_TRUE(tag.isTag(name));
+        EXPECT_EQ(tag.getItem({name, 0}), expected[static_cast<size_t>(i)]);
+        EXPECT_EQ(tag.tagRowOfItem(expected[static_cast<size_t>(i)]), TagRow(name, 0));
+    }
+
+    // default tag is used for empty tag name
+    EXPECT_EQ(tag.getItem({"", 0}), expected[n_tags / 2]);
+    EXPECT_FALSE(tag.isTag("tag40"));
+    EXPECT_THROW(tag.getItem({"tag40", 0}), std::runtime_error);
+}
+
+//! Move assignment transfers containers together with their items.
+
+TEST_F(SessionItemTagsTest, moveAssignment)
+{
+    SessionItemTags tags;
+    tags.registerTag(TagInfo::universalTag("tag1"), /*set_as_default*/ true);
+    auto child1 = new SessionItem;
+    tags.insertItem(child1, TagRow::append());
+
+    SessionItemTags other;
+    other.registerTag(TagInfo::universalTag("tag2"));
+    other.insertItem(new SessionItem, TagRow::append("tag2"));
+
+    // previous content of 'other' is deleted
+    other = std::move(tags);
+    EXPECT_EQ(other.defaultTag(), "tag1");
+    EXPECT_TRUE(other.isTag("tag1"));
+    EXPECT_FALSE(other.isTag("tag2"));
+    EXPECT_EQ(other.getItem({"tag1", 0}), child1);
+    EXPECT_EQ(other.tagRowOfItem(child1).row, 0);
+}
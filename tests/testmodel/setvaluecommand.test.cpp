@@ -9,6 +9,7 @@
 
 #include "google_test.h"
 #include <mvvm/commands/setvaluecommand.h>
+#include <mvvm/model/customvariants.h>
 #include <mvvm/model/sessionitem.h>
 #include <mvvm/model/sessionmodel.h>
 #include <stdexcept>
@@ -74,3 +75,45 @@ TEST_F(SetValueCommandTest, setSameValueCommand)
     // undoing command which is in isObsolete state is not possible
     EXPECT_THROW(command->undo(), std::runtime_error);
 }
+
+//! Description of the command is generated on demand and follows merged commands.
+
+TEST_F(SetValueCommandTest, description)
+{
+    SessionModel model;
+    const int role = ItemDataRole::DATA;
+    auto item = model.insertItem<SessionItem>();
+
+    SetValueMergePolicy policy{std::chrono::milliseconds(0), 1};
+    auto command = std::make_unique<SetValueCommand>(item, QVariant(42.0), role, policy);
+    command->execute();
+    EXPECT_EQ(command->description(), "Set value 42");
+
+    auto next_command = std::make_unique<SetValueCommand>(item, QVariant(43.0), role, policy);
+    next_command->execute();
+    EXPECT_TRUE(command->mergeWith(next_command.get()));
+    EXPECT_EQ(command->description(), "Set value 43");
+
+    // description stays the same after undo
+    command->undo();
+    EXPECT_EQ(command->description(), "Set value 43");
+}
+
+//! Command keeps only short summary of array value for the description.
+
+TEST_F(SetValueCommandTest, descriptionOfArray)
+{
+    SessionModel model;
+    const int role = ItemDataRole::DATA;
+    auto item = model.insertItem<SessionItem>();
+    item->setData(std::vector<double>(1000, 1.0), role);
+
+    auto command = std::make_unique<SetValueCommand>(
+        item, QVariant::fromValue(std::vector<double>(1000, 2.0)), role);
+    command->execute();
+    EXPECT_EQ(command->description(), "Set value std::vector<double>");
+
+    // only the value to restore on undo is kept
+    EXPECT_GT(command->byteSize(), 1000 * sizeof(double));
+    EXPECT_LT(command->byteSize(), 2000 * sizeof(double));
+}
@@ -0,0 +1,106 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <QUuid>
+#include <mvvm/core/uniqueid.h>
+#include <mvvm/core/uniqueidgenerator.h>
+#include <mvvm/model/customvariants.h>
+#include <unordered_set>
+
+using namespace ModelView;
+
+//! Tests of UniqueId and its conversion to/from textual identifiers.
+
+class UniqueIdTest : public ::testing::Test
+{
+public:
+    ~UniqueIdTest();
+};
+
+UniqueIdTest::~UniqueIdTest() = default;
+
+TEST_F(UniqueIdTest, initialState)
+{
+    UniqueId id;
+    EXPECT_TRUE(id.isNull());
+    EXPECT_EQ(id.toString(), "{00000000-0000-0000-0000-000000000000}");
+}
+
+TEST_F(UniqueIdTest, toString)
+{
+    UniqueId id(0x0123456789abcdefull, 0xfedcba9876543210ull);
+    EXPECT_FALSE(id.isNull());
+    EXPECT_EQ(id.toString(), "{01234567-89ab-cdef-fedc-ba9876543210}");
+}
+
+TEST_F(UniqueIdTest, fromString)
+{
+    UniqueId expected(0x0123456789abcdefull, 0xfedcba9876543210ull);
+    EXPECT_EQ(UniqueId::fromString("{01234567-89ab-cdef-fedc-ba9876543210}"), expected);
+    EXPECT_EQ(UniqueId::fromString("01234567-89AB-CDEF-FEDC-BA9876543210"), expected);
+
+    // invalid strings
+    EXPECT_TRUE(UniqueId::fromString("").isNull());
+    EXPECT_TRUE(UniqueId::fromString("abc-cde-fgh").isNull());
+    EXPECT_TRUE(UniqueId::fromString("{01234567-89ab-cdef-fedc-ba987654321x}").isNull());
+    EXPECT_TRUE(UniqueId::fromString("[01234567-89ab-cdef-fedc-ba9876543210]").isNull());
+    EXPECT_TRUE(UniqueId::fromString("{01234567+89ab-cdef-fedc-ba9876543210}").isNull());
+}
+
+TEST_F(UniqueIdTest, comparison)
+{
+    UniqueId id1(1, 2);
+    UniqueId id2(1, 3);
+    UniqueId id3(2, 0);
+
+    EXPECT_TRUE(id1 == UniqueId(1, 2));
+    EXPECT_TRUE(id1 != id2);
+    EXPECT_TRUE(id1 < id2);
+    EXPECT_TRUE(id2 < id3);
+    EXPECT_FALSE(id3 < id1);
+}
+
+//! Generated identifiers have the same textual form as QUuid.
+
+TEST_F(UniqueIdTest, generatedIdentifier)
+{
+    auto id = UniqueIdGenerator::generateId();
+    EXPECT_FALSE(id.isNull());
+
+    auto str = id.toString();
+    EXPECT_EQ(UniqueId::fromString(str), id);
+    EXPECT_EQ(QUuid(QString::fromStdString(str)).toString().toStdString(), str);
+
+    auto str2 = Utils::IdentifierToString(UniqueIdGenerator::generate());
+    EXPECT_EQ(UniqueId::fromString(str2).toString(), str2);
+    EXPECT_NE(str, str2);
+}
+
+TEST_F(UniqueIdTest, hashing)
+{
+    std::unordered_set<UniqueId> ids;
+    for (int i = 0; i < 100; ++i)
+        ids.insert(UniqueIdGenerator::generateId());
+    EXPECT_EQ(ids.size(), 100u);
+}
+
+//! Item identifiers of any type convert to the textual form and back without loss.
+
+TEST_F(UniqueIdTest, identifierConversion)
+{
+    auto id = UniqueIdGenerator::generate();
+    auto str = Utils::IdentifierToString(id);
+    EXPECT_EQ(str.size(), 38u);
+    EXPECT_EQ(Utils::IdentifierFromString(str), id);
+
+    // identifier read from file is converted to identifier_type
+    auto variant = Utils::IdentifierVariant(QVariant::fromValue(str));
+    EXPECT_EQ(variant.value<identifier_type>(), id);
+}
@@ -0,0 +1,43 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include <QUuid>
+#include <mvvm/core/uniqueidgenerator.h>
+#include <set>
+
+using namespace ModelView;
+
+//! Tests of UniqueIdGenerator.
+
+class UniqueIdGeneratorTest : public ::testing::Test
+{
+public:
+    ~UniqueIdGeneratorTest();
+};
+
+UniqueIdGeneratorTest::~UniqueIdGeneratorTest() = default;
+
+//! Generated identifiers have the same textual form as QUuid.
+
+TEST_F(UniqueIdGeneratorTest, generate)
+{
+    auto id = Utils::IdentifierToString(UniqueIdGenerator::generate());
+    EXPECT_EQ(id.size(), 38u);
+    EXPECT_FALSE(QUuid(QString::fromStdString(id)).isNull());
+    EXPECT_EQ(QUuid(QString::fromStdString(id)).toString().toStdString(), id);
+}
+
+TEST_F(UniqueIdGeneratorTest, uniqueness)
+{
+    std::set<std::string> ids;
+    for (int i = 0; i < 100; ++i)
+        ids.insert(Utils::IdentifierToString(UniqueIdGenerator::generate()));
+    EXPECT_EQ(ids.size(), 100u);
+}